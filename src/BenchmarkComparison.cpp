@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include "BenchmarkComparison.h"
+#include "BenchmarkRunner.h"
+
+BenchmarkComparison::BenchmarkComparison(
+    const std::string & baselineFile,
+    unsigned int runsAmount,
+    double slowdownThreshold,
+    const std::string & examplesDirectory,
+    const std::string & nameFilter)
+    :
+    baselinePath(baselineFile),
+    runs(std::max(1u, runsAmount)),
+    threshold(slowdownThreshold),
+    examplesPath(examplesDirectory),
+    filter(nameFilter) { }
+
+double BenchmarkComparison::median(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    size_t middle = samples.size() / 2;
+    return (samples.size() % 2 == 1) ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+}
+
+BenchmarkComparison::Samples BenchmarkComparison::parseResults(std::istream & in) {
+    std::string json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (json.find("\"benchmarks\"") == std::string::npos) {
+        throw std::invalid_argument("BenchmarkComparison: parseResults - missing benchmarks");
+    }
+
+    // Only names and samples are read, in order in which BenchmarkRunner writes them
+    Samples results;
+    const std::string nameKey = "\"name\":\"";
+    const std::string samplesKey = "\"samples_ns\":[";
+    for (size_t at = json.find(nameKey); at != std::string::npos; at = json.find(nameKey, at)) {
+        at += nameKey.size();
+        size_t nameEnd = json.find('"', at);
+        size_t samplesBegin = json.find(samplesKey, at);
+        size_t nextName = json.find(nameKey, at);
+        if (nameEnd == std::string::npos || samplesBegin == std::string::npos || samplesBegin > nextName) {
+            throw std::invalid_argument("BenchmarkComparison: parseResults - benchmark without samples");
+        }
+        samplesBegin += samplesKey.size();
+        size_t samplesEnd = json.find(']', samplesBegin);
+        if (samplesEnd == std::string::npos) {
+            throw std::invalid_argument("BenchmarkComparison: parseResults - unterminated samples");
+        }
+
+        std::vector<double> & samples = results[json.substr(at, nameEnd - at)];
+        std::istringstream values(json.substr(samplesBegin, samplesEnd - samplesBegin));
+        double value;
+        while (values >> value) {
+            samples.push_back(value);
+            if (values.peek() == ',') {
+                values.ignore();
+            }
+        }
+        if (!values.eof()) {
+            throw std::invalid_argument("BenchmarkComparison: parseResults - sample is not a number");
+        }
+        at = samplesEnd;
+    }
+
+    return results;
+}
+
+double BenchmarkComparison::mannWhitneyPValue(const std::vector<double> & current, const std::vector<double> & baseline) {
+    if (current.empty() || baseline.empty()) {
+        return 1;
+    }
+
+    // Rank all samples together, ties get average of their ranks
+    std::vector<std::pair<double, bool>> all; //< Sample and whether it is current
+    for (double sample : current) {
+        all.emplace_back(sample, true);
+    }
+    for (double sample : baseline) {
+        all.emplace_back(sample, false);
+    }
+    std::sort(all.begin(), all.end());
+
+    double n = all.size();
+    double currentRanks = 0;
+    double tieCorrection = 0;
+    for (size_t i = 0; i < all.size();) {
+        size_t j = i;
+        while (j < all.size() && all[j].first == all[i].first) {
+            j++;
+        }
+        double rank = (i + 1 + j) / 2.0;
+        double ties = j - i;
+        tieCorrection += ties * ties * ties - ties;
+        for (size_t k = i; k < j; k++) {
+            if (all[k].second) {
+                currentRanks += rank;
+            }
+        }
+        i = j;
+    }
+
+    double nCurrent = current.size();
+    double nBaseline = baseline.size();
+    double u = currentRanks - nCurrent * (nCurrent + 1) / 2;
+    double mean = nCurrent * nBaseline / 2;
+    double variance = nCurrent * nBaseline / 12 * ((n + 1) - tieCorrection / (n * (n - 1)));
+    if (variance <= 0) { //< All samples are equal
+        return 1;
+    }
+
+    double z = (u - mean - 0.5) / std::sqrt(variance);
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+BenchmarkComparison::Difference BenchmarkComparison::compare(
+    const std::string & name,
+    const std::vector<double> & current,
+    const std::vector<double> & baseline,
+    double slowdownThreshold) {
+    Difference difference;
+    difference.name = name;
+    difference.baselineMedian = median(baseline);
+    difference.currentMedian = median(current);
+    difference.change = difference.currentMedian / difference.baselineMedian - 1;
+    difference.pValue = mannWhitneyPValue(current, baseline);
+    difference.regression = (difference.change * 100 > slowdownThreshold)
+        && (difference.pValue < COMPARISONSIGNIFICANCE);
+    return difference;
+}
+
+int BenchmarkComparison::run(std::ostream & out, std::ostream & log) {
+    Samples baseline;
+    {
+        std::ifstream file(baselinePath);
+        if (!file.is_open()) {
+            out << "Couldn't open baseline " << baselinePath << std::endl;
+            return 2;
+        }
+        try {
+            baseline = parseResults(file);
+        }
+        catch (std::invalid_argument & e) {
+            out << "Couldn't read baseline " << baselinePath << ": " << e.what() << std::endl;
+            return 2;
+        }
+    }
+
+    // Samples of all runs are pooled, runs are whole suites, so slow periods of machine
+    // are spread over benchmarks
+    Samples current;
+    for (unsigned int r = 0; r < runs; r++) {
+        log << "run " << r + 1 << " of " << runs << std::endl;
+
+        std::stringstream results;
+        BenchmarkRunner runner(examplesPath, filter);
+        if (runner.run(results, log) != 0) {
+            out << "Benchmarks failed" << std::endl;
+            return 2;
+        }
+        for (auto & benchmark : parseResults(results)) {
+            std::vector<double> & samples = current[benchmark.first];
+            samples.insert(samples.end(), benchmark.second.begin(), benchmark.second.end());
+        }
+    }
+
+    out << std::left << std::setw(56) << "benchmark" << std::right
+        << std::setw(14) << "baseline [ns]"
+        << std::setw(14) << "current [ns]"
+        << std::setw(10) << "change"
+        << std::setw(10) << "p-value" << '\n';
+
+    unsigned int regressions = 0;
+    for (auto & benchmark : current) {
+        auto baselineSamples = baseline.find(benchmark.first);
+        if (baselineSamples == baseline.end() || baselineSamples->second.empty()) {
+            out << std::left << std::setw(56) << benchmark.first << "not in baseline\n";
+            continue;
+        }
+
+        Difference difference = compare(benchmark.first, benchmark.second, baselineSamples->second, threshold);
+        out << std::left << std::setw(56) << difference.name << std::right << std::fixed
+            << std::setprecision(1)
+            << std::setw(14) << difference.baselineMedian
+            << std::setw(14) << difference.currentMedian
+            << std::showpos << std::setw(9) << difference.change * 100 << '%' << std::noshowpos
+            << std::setprecision(4)
+            << std::setw(10) << difference.pValue
+            << (difference.regression ? "  REGRESSION" : "") << '\n';
+        if (difference.regression) {
+            regressions++;
+        }
+    }
+
+    out << std::defaultfloat << std::setprecision(6)
+        << regressions << " regressions (slowdown over " << threshold << " % with p-value below "
+        << COMPARISONSIGNIFICANCE << ")" << std::endl;
+    return regressions == 0 ? 0 : 1;
+}
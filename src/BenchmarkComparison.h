@@ -0,0 +1,131 @@
+/****************************************************************
+ * @file BenchmarkComparison.h
+ * @author Michal Dobes
+ * @brief Comparison of benchmarks against baseline
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef BENCHMARKCOMPARISON_H
+#define BENCHMARKCOMPARISON_H
+
+#define COMPARISONRUNS 3 //< Default number of runs of benchmarks
+#define COMPARISONTHRESHOLD 20 //< Default slowdown in percent from which benchmark regressed
+#define COMPARISONSIGNIFICANCE 0.01 //< Maximal p-value of slowdown, so it is not attributed to noise
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Comparison of benchmarks against baseline
+ *
+ * Loads baseline results of BenchmarkRunner (JSON), runs benchmarks present in
+ * baseline several times and compares samples of all runs with samples of
+ * baseline using one-sided Mann-Whitney U test.
+ *
+ * Benchmark regressed, if its median is slower than baseline by more than threshold
+ * and the slowdown is significant (p-value below COMPARISONSIGNIFICANCE).
+ *
+ */
+class BenchmarkComparison {
+public:
+    typedef std::map<std::string, std::vector<double>> Samples; //< Samples of benchmarks by name
+
+    /**
+     * @brief Comparison of one benchmark
+     *
+     */
+    struct Difference {
+        std::string name; //< Name of benchmark
+        double baselineMedian; //< Median of baseline samples in nanoseconds
+        double currentMedian; //< Median of current samples in nanoseconds
+        double change; //< Relative change of median, positive is slowdown
+        double pValue; //< Probability of such slowdown, if current isn't slower than baseline
+        bool regression; //< Slowdown is beyond threshold and significant
+    };
+
+private:
+    std::string baselinePath; //< Path to baseline JSON
+    unsigned int runs; //< Number of runs of benchmarks
+    double threshold; //< Slowdown in percent from which benchmark regressed
+    std::string examplesPath; //< Path to directory with examples for benchmarks
+    std::string filter; //< Only benchmarks whose name contains filter are compared
+
+    /**
+     * @brief Get median of samples
+     *
+     * @param samples samples, not empty
+     * @return double
+     */
+    static double median(std::vector<double> samples);
+
+public:
+    /**
+     * @brief Construct a new Benchmark Comparison object
+     *
+     * @param baselineFile path to baseline JSON
+     * @param runsAmount number of runs of benchmarks
+     * @param slowdownThreshold slowdown in percent from which benchmark regressed
+     * @param examplesDirectory path to directory with examples for benchmarks
+     * @param nameFilter only benchmarks whose name contains filter are compared
+     */
+    BenchmarkComparison(
+        const std::string & baselineFile,
+        unsigned int runsAmount = COMPARISONRUNS,
+        double slowdownThreshold = COMPARISONTHRESHOLD,
+        const std::string & examplesDirectory = "examples",
+        const std::string & nameFilter = "");
+
+    /**
+     * @brief Read samples of benchmarks from results of BenchmarkRunner
+     *
+     * @throws std::invalid_argument wrong format
+     *
+     * @param in stream with JSON results
+     * @return Samples
+     */
+    static Samples parseResults(std::istream & in);
+
+    /**
+     * @brief One-sided Mann-Whitney U test, that current samples are greater than baseline
+     *
+     * Uses normal approximation with correction for ties and continuity.
+     *
+     * @param current current samples
+     * @param baseline baseline samples
+     * @return double p-value, 1 if any of samples is empty
+     */
+    static double mannWhitneyPValue(const std::vector<double> & current, const std::vector<double> & baseline);
+
+    /**
+     * @brief Compare samples of benchmark
+     *
+     * @param name name of benchmark
+     * @param current current samples, not empty
+     * @param baseline baseline samples, not empty
+     * @param slowdownThreshold slowdown in percent from which benchmark regressed
+     * @return Difference
+     */
+    static Difference compare(
+        const std::string & name,
+        const std::vector<double> & current,
+        const std::vector<double> & baseline,
+        double slowdownThreshold);
+
+    /**
+     * @brief Run benchmarks and report comparison with baseline
+     *
+     * @param out stream into which comparison is reported
+     * @param log stream into which progress of benchmarks is reported
+     * @return int exit code, 0 if no benchmark regressed, 1 if some regressed,
+     *      2 if baseline couldn't be loaded or benchmarks failed
+     */
+    int run(std::ostream & out, std::ostream & log);
+};
+
+#endif /* BENCHMARKCOMPARISON_H */
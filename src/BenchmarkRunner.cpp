@@ -0,0 +1,433 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <ncurses.h>
+#include <string>
+#include <unistd.h>
+
+#include "BenchmarkRunner.h"
+#include "GameLogic/Board.h"
+#include "GameLogic/Game.h"
+#include "GameLogic/MazeGenerator.h"
+#include "GameLogic/Entities/Enemies.h"
+#include "Structures/Matrix.h"
+#include "Utilities/NCColors.h"
+#include "Utilities/Timer.h"
+#include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/FileManagers/BoardFileSaver.h"
+#include "Utilities/FileManagers/GameSettingsRecordsFileLoader.h"
+#include "ViewControllers/GameViewController.h"
+#include "Views/GameView.h"
+#include "Views/Renderers/AnsiRenderer.h"
+#include "Views/Renderers/NCursesRenderer.h"
+
+namespace {
+    /**
+     * @brief Keep value, so computation of it isn't optimized away
+     *
+     * @tparam T type of value
+     * @param value value
+     */
+    template <typename T>
+    inline void keep(const T & value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief Ncurses screen writing into /dev/null with window of its size, for drawing of views
+     *
+     */
+    class NullScreen {
+    private:
+        FILE * output; //< Output of screen
+        FILE * input; //< Input of screen
+        SCREEN * screen; //< Screen, nullptr if it couldn't be created
+        WINDOW * window; //< Window covering screen, nullptr if it couldn't be created
+
+    public:
+        /**
+         * @brief Construct a new Null Screen object
+         *
+         * @param lines number of lines of screen
+         * @param columns number of columns of screen
+         */
+        NullScreen(int lines, int columns) : screen(nullptr), window(nullptr) {
+            output = std::fopen("/dev/null", "w");
+            input = std::fopen("/dev/null", "r");
+            if (output != nullptr && input != nullptr) {
+                screen = newterm("xterm-256color", output, input);
+            }
+            if (screen != nullptr) {
+                resizeterm(lines, columns);
+                if (has_colors() == TRUE) {
+                    NCColors::initialize();
+                }
+                window = newwin(lines, columns, 0, 0);
+            }
+        }
+
+        /**
+         * @brief Destroy the Null Screen object
+         *
+         */
+        ~NullScreen() {
+            if (window != nullptr) {
+                delwin(window);
+            }
+            if (screen != nullptr) {
+                endwin();
+                delscreen(screen);
+            }
+            if (output != nullptr) {
+                std::fclose(output);
+            }
+            if (input != nullptr) {
+                std::fclose(input);
+            }
+        }
+
+        NullScreen(const NullScreen &) = delete;
+        NullScreen & operator = (const NullScreen &) = delete;
+
+        /**
+         * @brief Get window covering screen
+         *
+         * @return WINDOW* nullptr if screen couldn't be created
+         */
+        WINDOW * getWindow() const {
+            return window;
+        }
+
+        /**
+         * @brief Get file descriptor of output of screen
+         *
+         * @return int -1 if output couldn't be opened
+         */
+        int getOutput() const {
+            return (output != nullptr) ? fileno(output) : -1;
+        }
+    };
+
+    /**
+     * @brief Position following given one in row by row order, wrapping around board
+     *
+     * @param pos position
+     * @param board board
+     * @return Position
+     */
+    Position nextPosition(Position pos, const Board & board) {
+        if ((size_t)(++pos.x) >= board.getSizeX()) {
+            pos.x = 0;
+            if ((size_t)(++pos.y) >= board.getSizeY()) {
+                pos.y = 0;
+            }
+        }
+        return pos;
+    }
+}
+
+BenchmarkRunner::BenchmarkRunner(
+    const std::string & examplesDirectory,
+    const std::string & nameFilter,
+    unsigned int samplesAmount)
+    :
+    examplesPath(examplesDirectory),
+    filter(nameFilter),
+    samples(std::max(1u, samplesAmount)),
+    temporaryPath((std::filesystem::temp_directory_path()
+        / ("dobesmic_bench_" + std::to_string(getpid()))).string()) {
+    createBenchmarks();
+}
+
+void BenchmarkRunner::createBenchmarks() {
+    std::string smallMapPath = examplesPath + "/Maps/default.mpac";
+    std::string hugeMapPath = temporaryPath + "/huge.mpac";
+    std::string settingsPath = examplesPath + "/Settings/default.spac";
+
+    // Loads small map, shared by benchmarks of board
+    auto loadSmallMap = [ smallMapPath ]() {
+        BoardFileLoader loader(smallMapPath);
+        return std::make_shared<Board>(loader.loadBoard());
+    };
+
+    benchmarks.push_back({ "Matrix::at", [ ]() -> Body {
+        auto matrix = std::make_shared<Matrix<int>>(64, 64);
+        for (size_t y = 0; y < 64; y++) {
+            for (size_t x = 0; x < 64; x++) {
+                matrix->at(x, y) = x + y;
+            }
+        }
+        return [ matrix ](size_t operations) {
+            size_t x = 0, y = 0;
+            for (size_t i = 0; i < operations; i++) {
+                keep(matrix->at(x, y));
+                if (++x == 64) {
+                    x = 0;
+                    y = (y + 1) & 63;
+                }
+            }
+        };
+        } });
+
+    benchmarks.push_back({ "Board::isTileCrossroad", [ loadSmallMap ]() -> Body {
+        std::shared_ptr<Board> board = loadSmallMap();
+        return [ board ](size_t operations) {
+            Position pos(0, 0);
+            for (size_t i = 0; i < operations; i++) {
+                keep(board->isTileCrossroad(pos));
+                pos = nextPosition(pos, *board);
+            }
+        };
+        } });
+
+    benchmarks.push_back({ "Board::isTileAllowingMovement", [ loadSmallMap ]() -> Body {
+        std::shared_ptr<Board> board = loadSmallMap();
+        return [ board ](size_t operations) {
+            Position pos(0, 0);
+            for (size_t i = 0; i < operations; i++) {
+                keep(board->isTileAllowingMovement(pos));
+                pos = nextPosition(pos, *board);
+            }
+        };
+        } });
+
+    // Direction of ghost is calculated by steer (target of type and next direction),
+    // ghost then moves, so each operation is done at different position
+    for (Enemies::Type type : { Enemies::Type::blinky, Enemies::Type::pinky, Enemies::Type::inky, Enemies::Type::clyde }) {
+        benchmarks.push_back({ "Enemies::steer/" + Enemies::typeName(type), [ loadSmallMap, type ]() -> Body {
+            std::shared_ptr<Board> board = loadSmallMap();
+            auto enemies = std::make_shared<Enemies>(2);
+            Transform spawn(board->getEnemySpawn(), Rotation(Rotation::Direction::left));
+            enemies->add(type, spawn, Position(0, 0), true);
+            Transform player(board->getPlayerSpawn(), Rotation(Rotation::Direction::left));
+            return [ board, enemies, player ](size_t operations) {
+                for (size_t i = 0; i < operations; i++) {
+                    enemies->steer(0, *board, player, enemies->getPosition(0));
+                    enemies->advance(0, *board);
+                }
+                keep(enemies->getPosition(0));
+            };
+            } });
+    }
+
+    benchmarks.push_back({ "Timer::addTrigger", [ ]() -> Body {
+        return [ ](size_t operations) {
+            Timer timer(true);
+            for (size_t i = 0; i < operations; i++) {
+                timer.addTrigger(i % 1000 + 1, [ ]() { });
+            }
+        };
+        } });
+
+    benchmarks.push_back({ "Timer::update/fire", [ ]() -> Body {
+        auto timer = std::make_shared<Timer>(true);
+        auto fired = std::make_shared<size_t>(0);
+        timer->addTrigger(1, [ fired ]() { (*fired)++; }, true, "bench", Timer::CatchUp::all);
+        timer->togglePause();
+        return [ timer, fired ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                timer->advance(1);
+                timer->update();
+            }
+            keep(*fired);
+        };
+        } });
+
+    benchmarks.push_back({ "Timer::togglePause", [ ]() -> Body {
+        auto timer = std::make_shared<Timer>(true);
+        for (unsigned int t = 0; t < 16; t++) {
+            timer->addTrigger(100 + t, [ ]() { }, t % 2 == 0);
+        }
+        return [ timer ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                timer->togglePause();
+            }
+        };
+        } });
+
+    benchmarks.push_back({ "BoardFileLoader::loadBoard/small", [ smallMapPath ]() -> Body {
+        return [ smallMapPath ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                BoardFileLoader loader(smallMapPath);
+                keep(loader.loadBoard().getNumberOfCoins());
+            }
+        };
+        } });
+
+    benchmarks.push_back({ "BoardFileLoader::loadBoard/huge", [ this, hugeMapPath ]() -> Body {
+        std::filesystem::create_directories(temporaryPath);
+        MazeGenerator generator(BENCHMARKHUGEMAPSIZE, BENCHMARKHUGEMAPSIZE, 0.7, MazeGenerator::Symmetry::mirror, 1);
+        BoardFileSaver saver(hugeMapPath, false);
+        saver.writeBoard(generator.generate());
+
+        return [ hugeMapPath ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                BoardFileLoader loader(hugeMapPath);
+                keep(loader.loadBoard().getNumberOfCoins());
+            }
+        };
+        } });
+
+    benchmarks.push_back({ "GameSettingsRecordsFileLoader::loadSettingsAndRecords", [ settingsPath ]() -> Body {
+        return [ settingsPath ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                GameSettingsRecordsFileLoader loader(settingsPath);
+                keep(loader.loadSettingsAndRecords().first.playerSpeed);
+            }
+        };
+        } });
+
+    // Game is paused after restart, so GameView draws diff and entities on each draw,
+    // new GameView draws whole board on its first draw
+    auto prepareDraw = [ loadSmallMap, settingsPath ](bool wholeBoard) -> Body {
+        auto screen = std::make_shared<NullScreen>(60, 200);
+        if (screen->getWindow() == nullptr) {
+            throw std::runtime_error("ncurses screen couldn't be created");
+        }
+
+        GameSettingsRecordsFileLoader settingsLoader(settingsPath);
+        std::pair<unsigned int, double> difficulty = GameViewController::getDifficultyParameters(1);
+        auto game = std::make_shared<Game>(settingsLoader.loadSettingsAndRecords().first,
+            difficulty.second, difficulty.first, 1, true);
+        game->loadBoard(*loadSmallMap());
+        game->restart();
+
+        auto view = std::make_shared<GameView>(game.get());
+        return [ screen, game, view, wholeBoard ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                if (wholeBoard) {
+                    GameView(game.get()).draw(screen->getWindow());
+                } else {
+                    view->draw(screen->getWindow());
+                }
+            }
+        };
+    };
+    benchmarks.push_back({ "GameView::draw/board", [ prepareDraw ]() { return prepareDraw(true); } });
+    benchmarks.push_back({ "GameView::draw/frame", [ prepareDraw ]() { return prepareDraw(false); } });
+
+    // Whole board is drawn after clearing, so renderer writes whole screen
+    auto prepareRender = [ loadSmallMap, settingsPath ](bool ansi) -> Body {
+        auto screen = std::make_shared<NullScreen>(60, 200);
+        if (screen->getWindow() == nullptr) {
+            throw std::runtime_error("ncurses screen couldn't be created");
+        }
+
+        GameSettingsRecordsFileLoader settingsLoader(settingsPath);
+        std::pair<unsigned int, double> difficulty = GameViewController::getDifficultyParameters(1);
+        auto game = std::make_shared<Game>(settingsLoader.loadSettingsAndRecords().first,
+            difficulty.second, difficulty.first, 1, true);
+        game->loadBoard(*loadSmallMap());
+        game->restart();
+
+        std::shared_ptr<Renderer> renderer;
+        if (ansi) {
+            renderer = std::make_shared<AnsiRenderer>(screen->getOutput());
+        } else {
+            renderer = std::make_shared<NCursesRenderer>();
+        }
+        return [ screen, game, renderer ](size_t operations) {
+            for (size_t i = 0; i < operations; i++) {
+                renderer->clearScreen();
+                wnoutrefresh(stdscr);
+                GameView(game.get()).draw(screen->getWindow());
+                renderer->updateScreen();
+            }
+        };
+    };
+    benchmarks.push_back({ "Renderer::updateScreen/ncurses", [ prepareRender ]() { return prepareRender(false); } });
+    benchmarks.push_back({ "Renderer::updateScreen/ansi", [ prepareRender ]() { return prepareRender(true); } });
+}
+
+BenchmarkRunner::Result BenchmarkRunner::measure(const std::string & name, const Body & body) const {
+    typedef std::chrono::steady_clock clock;
+    const clock::duration sampleTime = std::chrono::milliseconds(BENCHMARKSAMPLETIME);
+
+    Result result { name, 1, { } };
+
+    // Double operations until sample is long enough, this also warms up caches
+    while (true) {
+        clock::time_point begin = clock::now();
+        body(result.operations);
+        if (clock::now() - begin >= sampleTime) {
+            break;
+        }
+        result.operations *= 2;
+    }
+
+    for (unsigned int s = 0; s < samples; s++) {
+        clock::time_point begin = clock::now();
+        body(result.operations);
+        std::chrono::duration<double, std::nano> duration = clock::now() - begin;
+        result.samples.push_back(duration.count() / result.operations);
+    }
+
+    return result;
+}
+
+void BenchmarkRunner::writeResult(std::ostream & out, const Result & result) {
+    std::vector<double> sorted(result.samples);
+    std::sort(sorted.begin(), sorted.end());
+
+    double median = (sorted.size() % 2 == 1)
+        ? sorted[sorted.size() / 2]
+        : (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2;
+    double mean = 0;
+    for (double sample : sorted) {
+        mean += sample;
+    }
+    mean /= sorted.size();
+    double variance = 0;
+    for (double sample : sorted) {
+        variance += (sample - mean) * (sample - mean);
+    }
+    variance /= std::max<size_t>(1, sorted.size() - 1);
+
+    out << "{\"name\":\"" << result.name << '"'
+        << ",\"operations\":" << result.operations
+        << ",\"median_ns\":" << median
+        << ",\"mean_ns\":" << mean
+        << ",\"min_ns\":" << sorted.front()
+        << ",\"max_ns\":" << sorted.back()
+        << ",\"stddev_ns\":" << std::sqrt(variance)
+        << ",\"samples_ns\":[";
+    for (size_t s = 0; s < result.samples.size(); s++) {
+        out << (s == 0 ? "" : ",") << result.samples[s];
+    }
+    out << "]}";
+}
+
+int BenchmarkRunner::run(std::ostream & out, std::ostream & log) {
+    int exitCode = 0;
+    bool first = true;
+
+    out << "{\"benchmarks\":[";
+    for (auto & benchmark : benchmarks) {
+        if (benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        try {
+            Result result = measure(benchmark.name, benchmark.prepare());
+
+            out << (first ? "\n" : ",\n");
+            writeResult(out, result);
+            first = false;
+
+            log << benchmark.name << ": " << result.samples.size() << " samples of "
+                << result.operations << " operations" << std::endl;
+        }
+        catch (std::exception & e) { //< Fixtures couldn't be prepared (including FileLoaderException)
+            log << benchmark.name << ": FAILED, " << e.what() << std::endl;
+            exitCode = 1;
+        }
+    }
+    out << "\n]}" << std::endl;
+
+    std::error_code error;
+    std::filesystem::remove_all(temporaryPath, error);
+    return exitCode;
+}
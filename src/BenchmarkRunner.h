@@ -0,0 +1,117 @@
+/****************************************************************
+ * @file BenchmarkRunner.h
+ * @author Michal Dobes
+ * @brief Runner of microbenchmarks of hot paths
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#define BENCHMARKSAMPLES 15 //< Default number of samples of each benchmark
+#define BENCHMARKSAMPLETIME 20 //< Minimal duration of one sample in milliseconds
+#define BENCHMARKHUGEMAPSIZE 1024 //< Size of generated huge map in both dimensions
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runner of microbenchmarks of hot paths
+ *
+ * Each benchmark performs an operation (e.g. one call of Matrix::at) in a loop.
+ * Number of operations in one sample is doubled until sample takes at least
+ * BENCHMARKSAMPLETIME, then samples are measured and their duration per operation
+ * is reported.
+ *
+ * Results are written as JSON:
+ *
+ *     {"benchmarks":[{"name":..., "operations":..., "median_ns":..., "mean_ns":...,
+ *       "min_ns":..., "max_ns":..., "stddev_ns":..., "samples_ns":[...]}, ...]}
+ *
+ * Fixtures of benchmark (loaded maps, generated huge map, ncurses screen) are
+ * prepared only if the benchmark is selected by filter.
+ *
+ */
+class BenchmarkRunner {
+public:
+    typedef std::function<void(size_t)> Body; //< Performs given number of operations
+
+private:
+    /**
+     * @brief Benchmark
+     *
+     */
+    struct Benchmark {
+        std::string name; //< Name of benchmark
+        std::function<Body()> prepare; //< Prepares fixtures, returns body of benchmark
+    };
+
+    /**
+     * @brief Measured samples of benchmark
+     *
+     */
+    struct Result {
+        std::string name; //< Name of benchmark
+        size_t operations; //< Operations in one sample
+        std::vector<double> samples; //< Duration of one operation in each sample, in nanoseconds
+    };
+
+    std::string examplesPath; //< Path to directory with examples (Maps and Settings)
+    std::string filter; //< Only benchmarks whose name contains filter are run
+    unsigned int samples; //< Number of samples of each benchmark
+    std::string temporaryPath; //< Path to directory for generated files, unique for process
+
+    std::vector<Benchmark> benchmarks; //< All benchmarks
+
+    /**
+     * @brief Create all benchmarks
+     *
+     */
+    void createBenchmarks();
+
+    /**
+     * @brief Measure samples of benchmark
+     *
+     * @param name name of benchmark
+     * @param body body of benchmark
+     * @return Result
+     */
+    Result measure(const std::string & name, const Body & body) const;
+
+    /**
+     * @brief Write result as JSON object
+     *
+     * @param out stream to write into
+     * @param result result
+     */
+    static void writeResult(std::ostream & out, const Result & result);
+
+public:
+    /**
+     * @brief Construct a new Benchmark Runner object
+     *
+     * @param examplesDirectory path to directory with examples (Maps and Settings)
+     * @param nameFilter only benchmarks whose name contains filter are run, empty runs all
+     * @param samplesAmount number of samples of each benchmark
+     */
+    BenchmarkRunner(
+        const std::string & examplesDirectory,
+        const std::string & nameFilter = "",
+        unsigned int samplesAmount = BENCHMARKSAMPLES);
+
+    /**
+     * @brief Run selected benchmarks
+     *
+     * @param out stream into which JSON results are written
+     * @param log stream into which progress and errors are reported
+     * @return int exit code, 0 if all selected benchmarks ran
+     */
+    int run(std::ostream & out, std::ostream & log);
+};
+
+#endif /* BENCHMARKRUNNER_H */
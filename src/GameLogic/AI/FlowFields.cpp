@@ -0,0 +1,148 @@
+#include <algorithm>
+
+#include "GameLogic/AI/FlowFields.h"
+
+void FlowFields::expand(Field & field) {
+    // Breadth first search from target against direction of movement, tile before
+    // position in direction is the one from which movement in direction ends at
+    // position (movement onto edge tile ends on complementary edge tile)
+    uint32_t index = field.queue[field.head++];
+    uint32_t distance = field.distances[index];
+    Position pos(index % sizeX, index / sizeX);
+    Position entered = board->isTileEdge(pos) ? board->complementaryEdgePosition(pos) : pos;
+
+    for (size_t d = 0; d < 4; d++) {
+        Rotation direction(d);
+        Position previous = entered.movedBy(1, direction.opposite());
+        if (!board->isTileAllowingMovement(previous)
+            || board->neighbourPosition(previous, direction) != pos) {
+            continue;
+        }
+
+        uint32_t previousIndex = tileIndex(previous);
+        if (field.distances.emplace(previousIndex, distance + 1).second) {
+            field.queue.push_back(previousIndex);
+        }
+    }
+}
+
+FlowFields::FlowFields()
+    :
+    board(nullptr),
+    sizeX(0),
+    usedFields(0),
+    computedFields(0),
+    requestedFields(0) { }
+
+void FlowFields::prepare(const Board * forBoard) {
+    board = forBoard;
+    sizeX = board->getSizeX();
+    fields.clear();
+    usedFields = 0;
+
+    // Breadth first search from all tiles allowing movement at once, through all tiles
+    nearestWalkable.assign(sizeX * board->getSizeY(), unreachable);
+    std::vector<uint32_t> queue;
+    for (size_t y = 0; y < board->getSizeY(); y++) {
+        for (size_t x = 0; x < sizeX; x++) {
+            Position pos(x, y);
+            if (board->isTileAllowingMovement(pos)) {
+                nearestWalkable[tileIndex(pos)] = tileIndex(pos);
+                queue.push_back(tileIndex(pos));
+            }
+        }
+    }
+
+    for (size_t head = 0; head < queue.size(); head++) {
+        uint32_t index = queue[head];
+        Position pos(index % sizeX, index / sizeX);
+
+        for (size_t d = 0; d < 4; d++) {
+            Position next = pos.movedBy(1, Rotation(d));
+            if (!board->isTileCoordinateValid(next)) {
+                continue;
+            }
+
+            uint32_t nextIndex = tileIndex(next);
+            if (nearestWalkable[nextIndex] == unreachable) {
+                nearestWalkable[nextIndex] = nearestWalkable[index];
+                queue.push_back(nextIndex);
+            }
+        }
+    }
+}
+
+void FlowFields::clear() {
+    // Field of target that stays is kept with its search
+    for (auto field = fields.begin(); field != fields.end();) {
+        if (!field->second.used) {
+            field = fields.erase(field);
+        } else {
+            field->second.used = false;
+            field++;
+        }
+    }
+    usedFields = 0;
+}
+
+Position FlowFields::resolveTarget(const Position & target) const {
+    // Move target into board
+    Position clamped(
+        std::clamp(target.x, 0, (int) sizeX - 1),
+        std::clamp(target.y, 0, (int) board->getSizeY() - 1));
+
+    uint32_t nearest = nearestWalkable[tileIndex(clamped)];
+    if (nearest == unreachable) { //< No tile allows movement
+        return clamped;
+    }
+    return Position(nearest % sizeX, nearest / sizeX);
+}
+
+FlowFields::Field & FlowFields::fieldTo(const Position & target) {
+    requestedFields++;
+
+    uint32_t resolved = tileIndex(resolveTarget(target));
+    auto found = fields.try_emplace(resolved);
+    Field & field = found.first->second;
+    if (found.second) {
+        field.distances.emplace(resolved, 0);
+        field.queue.push_back(resolved);
+        computedFields++;
+    }
+    if (!field.used || found.second) {
+        field.used = true;
+        usedFields++;
+    }
+
+    return field;
+}
+
+uint32_t FlowFields::distanceIn(Field & field, const Position & pos) {
+    if (!board->isTileAllowingMovement(pos)) {
+        return unreachable;
+    }
+
+    uint32_t index = tileIndex(pos);
+    auto found = field.distances.find(index);
+    while (found == field.distances.end() && field.head < field.queue.size()) {
+        expand(field);
+        found = field.distances.find(index);
+    }
+    return (found == field.distances.end()) ? unreachable : found->second;
+}
+
+uint32_t FlowFields::tileIndex(const Position & pos) const {
+    return (pos.y * sizeX) + pos.x;
+}
+
+size_t FlowFields::getFieldsInUse() const {
+    return usedFields;
+}
+
+unsigned long FlowFields::getComputedFields() const {
+    return computedFields;
+}
+
+unsigned long FlowFields::getRequestedFields() const {
+    return requestedFields;
+}
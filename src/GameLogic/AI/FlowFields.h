@@ -0,0 +1,161 @@
+/****************************************************************
+ * @file FlowFields.h
+ * @author Michal Dobes
+ * @brief Shared distance fields to targets in board
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef FLOWFIELDS_H
+#define FLOWFIELDS_H
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "GameLogic/Board.h"
+
+/**
+ * @brief Shared distance fields to targets in board
+ *
+ * Flow field of target tile contains for each tile the number of movements needed
+ * to get from the tile to the target, including teleports at edges of board.
+ *
+ * At most one field is searched for each target tile, so enemies that share
+ * target share one search. Choice of direction is then a lookup into the field.
+ * Search of field (breadth first from target) only continues until tile that is
+ * looked up is reached, so only surroundings of target up to the farthest enemy
+ * are searched and stored. Fields whose targets are requested again in the next
+ * movement of enemies are kept with their search, others are released by clear.
+ *
+ * Targets outside of board are moved into board and targets that don't allow
+ * movement are replaced by the nearest tile that allows movement.
+ *
+ */
+class FlowFields {
+public:
+    static constexpr uint32_t unreachable = std::numeric_limits<uint32_t>::max(); //< Distance
+    // of tile from which target can't be reached
+
+    /**
+     * @brief Field of one target, searched as far as lookups needed
+     *
+     */
+    struct Field {
+        std::unordered_map<uint32_t, uint32_t> distances; //< Distance to target of each reached tile
+        std::vector<uint32_t> queue; //< Reached tiles in order of distance
+        size_t head = 0; //< Index in queue of next tile whose neighbours are searched
+        bool used = true; //< Requested since last clear
+    };
+
+private:
+    const Board * board; //< Board in which fields are computed
+    size_t sizeX; //< Size of board in x dimension
+
+    std::vector<uint32_t> nearestWalkable; //< Index of the nearest tile allowing movement
+    // for each tile
+
+    std::unordered_map<uint32_t, Field> fields; //< Fields by target tile
+    size_t usedFields; //< Amount of fields requested since last clear
+
+    unsigned long computedFields; //< Amount of fields searched in total
+    unsigned long requestedFields; //< Amount of requested fields in total
+
+    /**
+     * @brief Search neighbours of next tile in queue of field
+     *
+     * @param field field
+     */
+    void expand(Field & field);
+
+public:
+    /**
+     * @brief Construct a new, empty Flow Fields object
+     *
+     */
+    FlowFields();
+
+    /**
+     * @brief Prepare fields for board
+     *
+     * Note, fields should not own the board object. Releases all fields.
+     *
+     * @param forBoard board in which fields are computed
+     */
+    void prepare(const Board * forBoard);
+
+    /**
+     * @brief Release fields that were not requested since last clear
+     *
+     * Should be called before each movement of enemies, as targets change.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Get tile that is used as target instead of position
+     *
+     * Board needs to be prepared using prepare before.
+     *
+     * @param target position of target, can be outside of board
+     * @return Position tile allowing movement nearest to target
+     */
+    Position resolveTarget(const Position & target) const;
+
+    /**
+     * @brief Get field to target
+     *
+     * Field is searched only if there is no field for resolved target.
+     * Board needs to be prepared using prepare before.
+     *
+     * @param target position of target, can be outside of board
+     * @return Field& field for distanceIn, valid until it is released by clear
+     */
+    Field & fieldTo(const Position & target);
+
+    /**
+     * @brief Get distance from tile to target in field
+     *
+     * Search of field continues until tile is reached.
+     *
+     * @param field field from fieldTo
+     * @param pos position of tile
+     * @return uint32_t distance, unreachable if position is outside of board or
+     *      target can't be reached from it
+     */
+    uint32_t distanceIn(Field & field, const Position & pos);
+
+    /**
+     * @brief Get index of tile at position
+     *
+     * @param pos position
+     * @return uint32_t
+     */
+    uint32_t tileIndex(const Position & pos) const;
+
+    /**
+     * @brief Get amount of fields requested since last clear
+     *
+     * @return size_t
+     */
+    size_t getFieldsInUse() const;
+
+    /**
+     * @brief Get amount of fields searched in total
+     *
+     * @return unsigned long
+     */
+    unsigned long getComputedFields() const;
+
+    /**
+     * @brief Get amount of requested fields in total
+     *
+     * @return unsigned long
+     */
+    unsigned long getRequestedFields() const;
+};
+
+#endif /* FLOWFIELDS_H */
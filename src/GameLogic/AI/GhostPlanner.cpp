@@ -0,0 +1,666 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <future>
+#include <random>
+
+#include "GameLogic/AI/GhostPlanner.h"
+
+namespace {
+    const size_t maxPlannedGhosts = 8; //< Only ghosts nearest to player are simulated
+    const size_t maxDeciders = 4; //< Joint choice at root is limited to this many ghosts
+    const unsigned int horizon = 60; //< Ghost movements simulated in one simulation
+    const size_t maxTreeNodes = 200000; //< Tree stops expanding after this many nodes
+    const double exploration = 0.7; //< Exploration constant of UCB
+    const size_t noChoice = static_cast<size_t>(-1); //< Ghost doesn't choose at root
+
+    /**
+     * @brief Search problem shared by all threads
+     *
+     */
+    struct Problem {
+        const JunctionGraph * graph;
+
+        std::vector<JunctionGraph::Approach> ghostApproaches; //< Paths of simulated ghosts
+        // to their next junctions
+        std::vector<uint32_t> ghostTiles; //< Current tiles of simulated ghosts
+        std::vector<size_t> deciders; //< Simulated ghosts that choose at root
+        std::vector<std::vector<Rotation>> deciderOptions; //< Exits for each decider
+        size_t rootActions; //< Number of joint choices
+
+        uint32_t playerTile; //< Current tile of player
+        uint32_t playerNode; //< Junction at which player is, none if in corridor
+        bool playerStuck; //< Player is in junction without exits and doesn't move
+        Rotation playerHeading; //< Direction of player's movement
+        std::vector<JunctionGraph::Approach> playerStarts; //< Possible paths of player
+        // to next junction
+
+        double playerStepsPerTick;
+        double maxDistance; //< Distance used to normalize reward
+    };
+
+    /**
+     * @brief Entity walking through junction graph
+     *
+     */
+    struct Walker {
+        const std::vector<uint32_t> * path; //< Tiles to walk through
+        size_t offset; //< Index of next tile in path
+        uint32_t node; //< Junction at end of path
+        Rotation arrival; //< Direction of arrival to junction
+        uint32_t tile; //< Current tile
+
+        /**
+         * @brief Move to next tile of path
+         *
+         * @return true junction at end of path was reached
+         * @return false
+         */
+        bool step() {
+            tile = (*path)[offset++];
+            return offset == path->size();
+        }
+    };
+
+    /**
+     * @brief Node of search tree
+     *
+     */
+    struct TreeNode {
+        std::vector<uint32_t> children; //< Index of child node for each action, 0 if not expanded
+        std::vector<uint32_t> visits; //< Visits of each action
+        std::vector<double> values; //< Sum of rewards of each action
+        uint32_t totalVisits = 0;
+    };
+
+    /**
+     * @brief Statistics of joint choices at root
+     *
+     */
+    struct SearchResult {
+        std::vector<uint32_t> visits;
+        std::vector<double> values;
+        unsigned long iterations = 0;
+        std::chrono::steady_clock::time_point finished; //< Time when search ended
+    };
+
+    /**
+     * @brief Search performed by single thread
+     *
+     */
+    class Search {
+    private:
+        const Problem & problem;
+        const std::vector<JunctionGraph::Node> & nodes;
+        const std::vector<JunctionGraph::Edge> & edges;
+
+        std::mt19937 random;
+        std::vector<TreeNode> tree;
+
+        std::vector<std::pair<uint32_t, uint32_t>> path; //< Tree nodes and actions of simulation
+        uint32_t cursor; //< Current tree node
+        bool inTree; //< Simulation still follows tree
+
+        std::vector<Walker> ghosts;
+        std::vector<size_t> rootChoice; //< Decider index for each simulated ghost, noChoice
+        // if ghost doesn't choose at root or already chose in current simulation
+        std::vector<Rotation> rootExits; //< Exits of joint choice of current simulation,
+        // indexed by decider
+        Walker player;
+
+        bool chance(double probability) {
+            return std::uniform_real_distribution<double>(0.0, 1.0)(random) < probability;
+        }
+
+        size_t randomIndex(size_t size) {
+            return std::uniform_int_distribution<size_t>(0, size - 1)(random);
+        }
+
+        void followEdge(Walker & walker, uint32_t node, const Rotation & exit) {
+            const JunctionGraph::Edge & edge = edges[nodes[node].edges[exit.direction]];
+            walker.path = &edge.tiles;
+            walker.offset = 0;
+            walker.node = edge.to;
+            walker.arrival = edge.arrival;
+        }
+
+        uint32_t createNode() {
+            tree.emplace_back();
+            return tree.size() - 1;
+        }
+
+        /**
+         * @brief Select action in tree node using UCB, untried actions first
+         *
+         */
+        uint32_t select(uint32_t nodeIndex) {
+            const TreeNode & node = tree[nodeIndex];
+
+            std::vector<uint32_t> untried;
+            for (uint32_t a = 0; a < node.visits.size(); a++) {
+                if (node.visits[a] == 0) {
+                    untried.push_back(a);
+                }
+            }
+            if (!untried.empty()) {
+                return untried[randomIndex(untried.size())];
+            }
+
+            uint32_t best = 0;
+            double bestScore = -1.0;
+            double logVisits = std::log(node.totalVisits);
+            for (uint32_t a = 0; a < node.visits.size(); a++) {
+                double score = (node.values[a] / node.visits[a])
+                    + exploration * std::sqrt(logVisits / node.visits[a]);
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = a;
+                }
+            }
+            return best;
+        }
+
+        /**
+         * @brief Record action in tree node and descend to its child
+         *
+         */
+        void descend(uint32_t nodeIndex, uint32_t action) {
+            path.emplace_back(nodeIndex, action);
+
+            uint32_t child = tree[nodeIndex].children[action];
+            if (child != 0) {
+                cursor = child;
+                return;
+            }
+
+            // Expand one node per simulation, then continue outside of tree
+            if (tree.size() < maxTreeNodes) {
+                child = createNode();
+                tree[nodeIndex].children[action] = child;
+            }
+            inTree = false;
+        }
+
+        std::vector<Rotation> ghostExits(uint32_t node, const Rotation & arrival) const {
+            std::vector<Rotation> exits;
+            for (size_t d = 0; d < 4; d++) {
+                if (nodes[node].edges[d] != JunctionGraph::none && Rotation(d) != arrival.opposite()) {
+                    exits.emplace_back(d);
+                }
+            }
+            if (exits.empty()) { //< Dead end, turn around
+                exits.push_back(arrival.opposite());
+            }
+            return exits;
+        }
+
+        /**
+         * @brief Choose exit for ghost that reached junction
+         *
+         */
+        Rotation chooseGhostExit(size_t g) {
+            Walker & ghost = ghosts[g];
+            std::vector<Rotation> exits = ghostExits(ghost.node, ghost.arrival);
+
+            // Tree decision
+            if (inTree && exits.size() > 1) {
+                TreeNode & node = tree[cursor];
+                if (node.visits.empty()) {
+                    node.children.assign(exits.size(), 0);
+                    node.visits.assign(exits.size(), 0);
+                    node.values.assign(exits.size(), 0.0);
+                }
+                if (node.visits.size() == exits.size()) {
+                    uint32_t action = select(cursor);
+                    descend(cursor, action);
+                    return exits[action];
+                }
+                inTree = false;
+            }
+
+            // Simulation policy, mostly greedy towards player as ghosts usually behave
+            if (exits.size() == 1 || !chance(0.8)) {
+                return exits[randomIndex(exits.size())];
+            }
+
+            Position playerPos = problem.graph->tilePosition(player.tile);
+            Rotation best = exits.front();
+            double bestDistance = -1.0;
+            for (auto & e : exits) {
+                Position next = problem.graph->tilePosition(edges[nodes[ghost.node].edges[e.direction]].tiles.front());
+                double distance = Position::distanceBetween(next, playerPos);
+                if (bestDistance < 0.0 || distance < bestDistance) {
+                    bestDistance = distance;
+                    best = e;
+                }
+            }
+            return best;
+        }
+
+        /**
+         * @brief Choose exit for player that reached junction
+         *
+         */
+        Rotation choosePlayerExit(uint32_t nodeIndex, const Rotation & arrival) {
+            std::vector<Rotation> exits;
+            for (size_t d = 0; d < 4; d++) {
+                if (nodes[nodeIndex].edges[d] != JunctionGraph::none) {
+                    exits.emplace_back(d);
+                }
+            }
+            if (exits.empty()) { //< Player can't leave junction
+                return arrival;
+            }
+
+            // Player mostly doesn't turn around
+            if (exits.size() > 1 && chance(0.8)) {
+                exits.erase(std::remove(exits.begin(), exits.end(), arrival.opposite()), exits.end());
+            }
+
+            if (exits.size() == 1 || chance(0.5)) {
+                return exits[randomIndex(exits.size())];
+            }
+
+            // Flee, choose exit leading to junction farthest from nearest ghost
+            Rotation best = exits.front();
+            long bestDistance = -1;
+            for (auto & e : exits) {
+                Position next = nodes[edges[nodes[nodeIndex].edges[e.direction]].to].position;
+                long nearest = problem.maxDistance;
+                for (auto & g : ghosts) {
+                    Position ghostPos = problem.graph->tilePosition(g.tile);
+                    nearest = std::min(nearest, (long)(std::abs(ghostPos.x - next.x) + std::abs(ghostPos.y - next.y)));
+                }
+                if (nearest > bestDistance) {
+                    bestDistance = nearest;
+                    best = e;
+                }
+            }
+            return best;
+        }
+
+        bool playerCaught() const {
+            for (auto & g : ghosts) {
+                if (g.tile == player.tile) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        double caughtReward(unsigned int tick) const {
+            return 1.0 - 0.5 * (double(tick) / horizon);
+        }
+
+        /**
+         * @brief Simulate one game from current state
+         *
+         * @return double reward of ghosts
+         */
+        double simulate() {
+            // Reset simulated entities
+            rootChoice.assign(ghosts.size(), noChoice);
+            for (size_t i = 0; i < problem.deciders.size(); i++) {
+                rootChoice[problem.deciders[i]] = i;
+            }
+            for (size_t g = 0; g < ghosts.size(); g++) {
+                ghosts[g] = Walker {
+                    &problem.ghostApproaches[g].tiles,
+                    0,
+                    problem.ghostApproaches[g].node,
+                    problem.ghostApproaches[g].arrival,
+                    problem.ghostTiles[g] };
+            }
+
+            if (problem.playerStuck) {
+                player = Walker { nullptr, 0, problem.playerNode, problem.playerHeading, problem.playerTile };
+            } else if (problem.playerNode != JunctionGraph::none) {
+                player.tile = problem.playerTile;
+                followEdge(player, problem.playerNode, choosePlayerExit(problem.playerNode, problem.playerHeading));
+            } else {
+                const JunctionGraph::Approach & start = problem.playerStarts[randomIndex(problem.playerStarts.size())];
+                player = Walker { &start.tiles, 0, start.node, start.arrival, problem.playerTile };
+            }
+
+            double playerSteps = 0.0;
+            for (unsigned int tick = 1; tick <= horizon; tick++) {
+                for (size_t g = 0; g < ghosts.size(); g++) {
+                    if (ghosts[g].step()) {
+                        // Deciding ghosts reach their crossroad with the first movement
+                        Rotation exit = (rootChoice[g] != noChoice)
+                            ? rootExits[rootChoice[g]]
+                            : chooseGhostExit(g);
+                        rootChoice[g] = noChoice;
+                        followEdge(ghosts[g], ghosts[g].node, exit);
+                    }
+                    if (ghosts[g].tile == player.tile) {
+                        return caughtReward(tick);
+                    }
+                }
+
+                playerSteps += problem.playerStuck ? 0.0 : problem.playerStepsPerTick;
+                while (playerSteps >= 1.0) {
+                    playerSteps -= 1.0;
+                    if (player.step()) {
+                        followEdge(player, player.node, choosePlayerExit(player.node, player.arrival));
+                    }
+                    if (playerCaught()) {
+                        return caughtReward(tick);
+                    }
+                }
+            }
+
+            // Not caught, reward ghosts for being close to player
+            Position playerPos = problem.graph->tilePosition(player.tile);
+            double nearest = problem.maxDistance;
+            for (auto & g : ghosts) {
+                Position ghostPos = problem.graph->tilePosition(g.tile);
+                nearest = std::min(nearest, double(std::abs(ghostPos.x - playerPos.x) + std::abs(ghostPos.y - playerPos.y)));
+            }
+            return 0.4 * (1.0 - (nearest / problem.maxDistance));
+        }
+
+    public:
+        Search(const Problem & searchProblem, unsigned int seed)
+            :
+            problem(searchProblem),
+            nodes(searchProblem.graph->getNodes()),
+            edges(searchProblem.graph->getEdges()),
+            random(seed),
+            cursor(0),
+            inTree(true),
+            ghosts(searchProblem.ghostApproaches.size()),
+            rootExits(searchProblem.deciders.size()),
+            player { nullptr, 0, JunctionGraph::none, Rotation(), 0 } {
+
+            uint32_t root = createNode();
+            tree[root].children.assign(problem.rootActions, 0);
+            tree[root].visits.assign(problem.rootActions, 0);
+            tree[root].values.assign(problem.rootActions, 0.0);
+
+        }
+
+        SearchResult run(std::chrono::steady_clock::time_point deadline) {
+            SearchResult result;
+
+            while (std::chrono::steady_clock::now() < deadline) {
+                path.clear();
+                cursor = 0;
+                inTree = true;
+
+                // Joint choice of deciding ghosts at root
+                uint32_t action = select(0);
+                uint32_t remaining = action;
+                for (size_t i = 0; i < problem.deciders.size(); i++) {
+                    const std::vector<Rotation> & options = problem.deciderOptions[i];
+                    rootExits[i] = options[remaining % options.size()];
+                    remaining /= options.size();
+                }
+                descend(0, action);
+
+                double reward = simulate();
+
+                for (auto & p : path) {
+                    TreeNode & node = tree[p.first];
+                    node.visits[p.second]++;
+                    node.values[p.second] += reward;
+                    node.totalVisits++;
+                }
+                result.iterations++;
+            }
+
+            result.visits = tree[0].visits;
+            result.values = tree[0].values;
+            result.finished = std::chrono::steady_clock::now();
+            return result;
+        }
+    };
+}
+
+/**
+ * @brief Plan started in background
+ *
+ */
+struct GhostPlanner::Pending {
+    std::vector<std::optional<GhostState>> ghosts; //< States plan was started for
+    clock::time_point begin; //< Time when plan was started
+    Problem problem; //< Problem searched by threads
+    std::vector<size_t> deciderGhosts; //< Index in ghosts for each decider
+    std::vector<std::future<SearchResult>> searches; //< Searches running on threads
+};
+
+GhostPlanner::GhostPlanner(
+    unsigned int budgetMilliseconds,
+    unsigned int ghostPeriod,
+    unsigned int playerPeriod,
+    size_t threads,
+    unsigned int seed)
+    :
+    pool(threads),
+    seeds(seed),
+    lastPlanTime(0.0),
+    maxPlanTime(0.0),
+    lastIterations(0) {
+    configure(budgetMilliseconds, ghostPeriod, playerPeriod);
+}
+
+GhostPlanner::~GhostPlanner() {
+    discard();
+}
+
+void GhostPlanner::discard() {
+    if (!pending) {
+        return;
+    }
+    for (auto & s : pending->searches) {
+        s.wait(); //< Searches use problem and graph, which can't be released before them
+    }
+    pending.reset();
+}
+
+void GhostPlanner::configure(unsigned int budgetMilliseconds, unsigned int ghostPeriod, unsigned int playerPeriod) {
+    discard(); //< Started plan uses previous periods
+    budget = std::chrono::milliseconds(std::min<unsigned int>(budgetMilliseconds, ghostPeriod * GHOSTPLANNERMAXBUDGETSHARE));
+    playerStepsPerTick = (playerPeriod == 0) ? 1.0 : (double(ghostPeriod) / playerPeriod);
+}
+
+void GhostPlanner::prepare(const Board * board) {
+    discard();
+    if (graph.getBoard() != board) {
+        graph = JunctionGraph(board);
+    }
+}
+
+std::vector<std::optional<Position>> GhostPlanner::plan(
+    const std::vector<std::optional<GhostState>> & ghosts,
+    const Transform & playerTransform) {
+    start(ghosts, playerTransform);
+    return collect(ghosts);
+}
+
+void GhostPlanner::start(
+    const std::vector<std::optional<GhostState>> & ghosts,
+    const Transform & playerTransform) {
+    discard();
+
+    const Board * board = graph.getBoard();
+    if (board == nullptr || !board->isTileCoordinateValid(playerTransform.position)) {
+        return;
+    }
+
+    std::unique_ptr<Pending> started = std::make_unique<Pending>();
+    started->ghosts = ghosts;
+    started->begin = clock::now();
+    Problem & problem = started->problem;
+    std::vector<size_t> & deciderGhosts = started->deciderGhosts;
+
+    problem.graph = &graph;
+    problem.playerStepsPerTick = playerStepsPerTick;
+    problem.maxDistance = board->getSizeX() + board->getSizeY();
+
+    // Player's start
+    problem.playerTile = graph.tileIndex(playerTransform.position);
+    problem.playerNode = graph.nodeAt(playerTransform.position);
+    problem.playerHeading = playerTransform.rotation;
+    problem.playerStuck = false;
+    if (problem.playerNode != JunctionGraph::none) {
+        const auto & playerEdges = graph.getNodes()[problem.playerNode].edges;
+        problem.playerStuck = std::all_of(std::begin(playerEdges), std::end(playerEdges), [](uint32_t edge) {
+            return edge == JunctionGraph::none;
+            });
+    }
+    if (problem.playerNode == JunctionGraph::none) {
+        // If player can't continue in its direction, it can go any way along corridor
+        for (size_t d = 0; d < 4; d++) {
+            Rotation r(d);
+            if ((r == playerTransform.rotation || problem.playerStarts.empty())
+                && board->isTileAllowingMovement(playerTransform.position.movedBy(1, r))) {
+                JunctionGraph::Approach start = graph.approach(playerTransform.position, r);
+                if (start.node != JunctionGraph::none) {
+                    if (r == playerTransform.rotation) {
+                        problem.playerStarts.clear();
+                    }
+                    problem.playerStarts.push_back(std::move(start));
+                }
+            }
+        }
+        if (problem.playerStarts.empty()) {
+            return;
+        }
+    }
+
+    // Simulate only ghosts nearest to player
+    std::vector<size_t> order;
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (ghosts[i] && board->isTileCoordinateValid(ghosts[i]->position)) {
+            order.push_back(i);
+        }
+    }
+    auto playerDistance = [ & ](size_t i) {
+        return std::abs(ghosts[i]->position.x - playerTransform.position.x)
+            + std::abs(ghosts[i]->position.y - playerTransform.position.y);
+        };
+    std::sort(order.begin(), order.end(), [ & ](size_t lhs, size_t rhs) {
+        return playerDistance(lhs) < playerDistance(rhs);
+        });
+
+    problem.rootActions = 1;
+    for (size_t i : order) {
+        if (problem.ghostApproaches.size() >= maxPlannedGhosts) {
+            break;
+        }
+
+        JunctionGraph::Approach approach = graph.approach(ghosts[i]->position, ghosts[i]->heading);
+        if (approach.node == JunctionGraph::none) {
+            continue;
+        }
+
+        // Ghost enters crossroad with next movement, its exit is chosen at root
+        Position nextTile = graph.tilePosition(approach.tiles.front());
+        if (approach.tiles.size() == 1 && board->isTileCrossroad(nextTile) && problem.deciders.size() < maxDeciders) {
+            std::vector<Rotation> options;
+            for (size_t d = 0; d < 4; d++) {
+                if (graph.getNodes()[approach.node].edges[d] != JunctionGraph::none
+                    && Rotation(d) != approach.arrival.opposite()) {
+                    options.emplace_back(d);
+                }
+            }
+            if (!options.empty()) {
+                problem.deciders.push_back(problem.ghostApproaches.size());
+                problem.rootActions *= options.size();
+                problem.deciderOptions.push_back(std::move(options));
+                deciderGhosts.push_back(i);
+            }
+        }
+
+        problem.ghostTiles.push_back(graph.tileIndex(ghosts[i]->position));
+        problem.ghostApproaches.push_back(std::move(approach));
+    }
+
+    if (problem.deciders.empty()) {
+        return;
+    }
+
+    // Search on all threads until deadline
+    clock::time_point deadline = started->begin + budget;
+    unsigned int seed = seeds();
+    for (size_t t = 0; t < pool.size(); t++) {
+        started->searches.push_back(pool.submit([ &problem, deadline, seed, t ]() {
+            Search search(problem, seed + t);
+            return search.run(deadline);
+            }));
+    }
+    pending = std::move(started);
+}
+
+std::vector<std::optional<Position>> GhostPlanner::collect(const std::vector<std::optional<GhostState>> & ghosts) {
+    std::vector<std::optional<Position>> targets(ghosts.size());
+    if (!pending) {
+        lastPlanTime = 0.0;
+        lastIterations = 0;
+        return targets;
+    }
+    std::unique_ptr<Pending> collected = std::move(pending);
+    const Problem & problem = collected->problem;
+
+    std::vector<uint32_t> visits(problem.rootActions, 0);
+    std::vector<double> values(problem.rootActions, 0.0);
+    clock::time_point finished = collected->begin;
+    lastIterations = 0;
+    for (auto & s : collected->searches) {
+        SearchResult result = s.get();
+        for (size_t a = 0; a < problem.rootActions; a++) {
+            visits[a] += result.visits[a];
+            values[a] += result.values[a];
+        }
+        lastIterations += result.iterations;
+        finished = std::max(finished, result.finished);
+    }
+
+    lastPlanTime = std::chrono::duration<double, std::milli>(finished - collected->begin).count();
+    maxPlanTime = std::max(maxPlanTime, lastPlanTime);
+
+    // Choose the most visited joint choice
+    size_t best = 0;
+    for (size_t a = 1; a < problem.rootActions; a++) {
+        if (visits[a] > visits[best]
+            || (visits[a] == visits[best] && visits[a] != 0 && values[a] / visits[a] > values[best] / visits[best])) {
+            best = a;
+        }
+    }
+    if (visits[best] == 0) {
+        return targets;
+    }
+
+    // Ghosts that didn't reach state plan was started for (eaten, frightened) are left to themselves
+    size_t remaining = best;
+    for (size_t i = 0; i < problem.deciders.size(); i++) {
+        const std::vector<Rotation> & options = problem.deciderOptions[i];
+        Rotation exit = options[remaining % options.size()];
+        remaining /= options.size();
+
+        size_t g = collected->deciderGhosts[i];
+        const std::optional<GhostState> & planned = collected->ghosts[g];
+        if (g >= ghosts.size() || !ghosts[g] || ghosts[g]->position != planned->position
+            || ghosts[g]->heading != planned->heading) {
+            continue;
+        }
+
+        Position crossroad = graph.tilePosition(problem.ghostApproaches[problem.deciders[i]].tiles.front());
+        targets[g] = graph.getBoard()->neighbourPosition(crossroad, exit);
+    }
+
+    return targets;
+}
+
+double GhostPlanner::getLastPlanTime() const {
+    return lastPlanTime;
+}
+
+double GhostPlanner::getMaxPlanTime() const {
+    return maxPlanTime;
+}
+
+unsigned long GhostPlanner::getLastIterations() const {
+    return lastIterations;
+}
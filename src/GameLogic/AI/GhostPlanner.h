@@ -0,0 +1,191 @@
+/****************************************************************
+ * @file GhostPlanner.h
+ * @author Michal Dobes
+ * @brief Coordinated planning of enemy ghosts
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef GHOSTPLANNER_H
+#define GHOSTPLANNER_H
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "GameLogic/AI/JunctionGraph.h"
+#include "Utilities/ThreadPool.h"
+
+#define GHOSTPLANNERMAXBUDGETSHARE 0.5 //< Share of ghost period that plan can take at most
+#define GHOSTPLANNERDEFAULTSEED 5489 //< Default seed of random generators of searches
+
+/**
+ * @brief Coordinated planning of enemy ghosts
+ *
+ * Ghosts that are about to enter a crossroad choose their exits together using
+ * Monte-Carlo tree search over junction graph of board. Tree is searched from
+ * joint choice of deciding ghosts, further levels are choices of single ghosts
+ * in order in which they reach junctions. Player moves randomly (with tendency
+ * to flee from ghosts) during simulations. Reward is shared by all ghosts and is
+ * higher when player is caught sooner.
+ *
+ * Search runs independently on each thread of thread pool until time budget
+ * runs out, statistics of joint choices from all threads are summed. Random
+ * generators of searches are seeded from seed of planner, so planner with the
+ * same seed draws the same random numbers.
+ *
+ * Plan can run in background between ghost movements: it is started for the
+ * state ghosts will reach with their next movement and collected when they
+ * reach it. Budget is limited to GHOSTPLANNERMAXBUDGETSHARE of ghost period,
+ * so plan is usually finished before it is collected.
+ *
+ */
+class GhostPlanner {
+public:
+    /**
+     * @brief State of ghost after its last movement
+     *
+     */
+    struct GhostState {
+        Position position; //< Current position
+        Rotation heading; //< Direction of next movement
+    };
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    JunctionGraph graph; //< Junction graph of current board
+    ThreadPool pool; //< Threads for searching
+
+    std::chrono::milliseconds budget; //< Time for one plan
+    double playerStepsPerTick; //< Player's movements per one ghost movement
+    std::mt19937 seeds; //< Generator of seeds of searches
+
+    double lastPlanTime; //< Duration of last plan in milliseconds
+    double maxPlanTime; //< Maximal duration of plan in milliseconds
+    unsigned long lastIterations; //< Simulations performed in last plan
+
+    struct Pending;
+    std::unique_ptr<Pending> pending; //< Started plan that wasn't collected yet
+
+    /**
+     * @brief Wait for searches of started plan and discard it
+     *
+     */
+    void discard();
+
+public:
+    /**
+     * @brief Construct a new Ghost Planner object
+     *
+     * @param budgetMilliseconds time budget for one plan, at most GHOSTPLANNERMAXBUDGETSHARE of ghostPeriod
+     * @param ghostPeriod period between ghost movements
+     * @param playerPeriod period between player movements
+     * @param threads number of threads for searching, if 0 number of hardware threads is used
+     * @param seed seed of random generators of searches
+     */
+    GhostPlanner(
+        unsigned int budgetMilliseconds,
+        unsigned int ghostPeriod,
+        unsigned int playerPeriod,
+        size_t threads = 0,
+        unsigned int seed = GHOSTPLANNERDEFAULTSEED);
+
+    /**
+     * @brief Destroy the Ghost Planner object, waiting for started plan
+     *
+     */
+    ~GhostPlanner();
+
+    GhostPlanner(const GhostPlanner &) = delete;
+    GhostPlanner & operator = (const GhostPlanner &) = delete;
+
+    /**
+     * @brief Change budget and periods of movements (after settings changed)
+     *
+     * Started plan is discarded.
+     *
+     * @param budgetMilliseconds time budget for one plan, at most GHOSTPLANNERMAXBUDGETSHARE of ghostPeriod
+     * @param ghostPeriod period between ghost movements
+     * @param playerPeriod period between player movements
+     */
+    void configure(unsigned int budgetMilliseconds, unsigned int ghostPeriod, unsigned int playerPeriod);
+
+    /**
+     * @brief Prepare planner for board
+     *
+     * Builds junction graph of board, if it was not built for the board already.
+     * Started plan is discarded. Note, planner should not own the board object.
+     *
+     * @param board board in which ghosts move
+     */
+    void prepare(const Board * board);
+
+    /**
+     * @brief Plan next movement of ghosts, waiting for the plan
+     *
+     * Board needs to be prepared using prepare before. Same as start followed by collect.
+     *
+     * @param ghosts states of ghosts, empty for ghosts that don't take part in planning
+     * @param playerTransform transform of player
+     * @return std::vector<std::optional<Position>> for each ghost in ghosts, target
+     *      the ghost should move to from next crossroad, empty if ghost doesn't enter
+     *      crossroad or couldn't be planned
+     */
+    std::vector<std::optional<Position>> plan(
+        const std::vector<std::optional<GhostState>> & ghosts,
+        const Transform & playerTransform);
+
+    /**
+     * @brief Start planning movement of ghosts in background
+     *
+     * Board needs to be prepared using prepare before. Plan started before that
+     * wasn't collected is discarded.
+     *
+     * @param ghosts states ghosts will have, empty for ghosts that don't take part in planning
+     * @param playerTransform transform of player
+     */
+    void start(
+        const std::vector<std::optional<GhostState>> & ghosts,
+        const Transform & playerTransform);
+
+    /**
+     * @brief Collect targets of started plan
+     *
+     * Waits until searches of plan end (at most until its budget runs out).
+     *
+     * @param ghosts states ghosts have now
+     * @return std::vector<std::optional<Position>> for each ghost in ghosts, target
+     *      the ghost should move to from next crossroad, empty if ghost doesn't enter
+     *      crossroad, couldn't be planned or its state differs from the one plan
+     *      was started with
+     */
+    std::vector<std::optional<Position>> collect(const std::vector<std::optional<GhostState>> & ghosts);
+
+    /**
+     * @brief Get duration of last plan
+     *
+     * @return double milliseconds
+     */
+    double getLastPlanTime() const;
+
+    /**
+     * @brief Get maximal duration of plan
+     *
+     * @return double milliseconds
+     */
+    double getMaxPlanTime() const;
+
+    /**
+     * @brief Get number of simulations performed in last plan
+     *
+     * @return unsigned long
+     */
+    unsigned long getLastIterations() const;
+};
+
+#endif /* GHOSTPLANNER_H */
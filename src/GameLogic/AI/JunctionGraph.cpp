@@ -0,0 +1,112 @@
+#include "GameLogic/AI/JunctionGraph.h"
+
+size_t JunctionGraph::countPaths(const Position & pos) const {
+    size_t paths = 0;
+    for (size_t d = 0; d < 4; d++) {
+        if (board->isTileAllowingMovement(pos.movedBy(1, Rotation(d)))) {
+            paths++;
+        }
+    }
+    return paths;
+}
+
+Rotation JunctionGraph::corridorDirection(const Position & pos, const Rotation & heading) const {
+    // Same rule as enemy uses when it is not at crossroad
+    for (size_t d = 0; d < 4; d++) {
+        Rotation processingRotation(d);
+        if (processingRotation != heading.opposite()
+            && board->isTileAllowingMovement(pos.movedBy(1, processingRotation))) {
+            return processingRotation;
+        }
+    }
+    return heading.opposite();
+}
+
+JunctionGraph::JunctionGraph() : board(nullptr), sizeX(0) { }
+
+JunctionGraph::JunctionGraph(const Board * forBoard) : board(forBoard), sizeX(forBoard->getSizeX()) {
+    nodeOfTile.assign(board->getSizeX() * board->getSizeY(), none);
+
+    // Junctions are crossroads and dead ends, tiles at edges are teleports and
+    // can't be dead ends
+    for (size_t y = 0; y < board->getSizeY(); y++) {
+        for (size_t x = 0; x < board->getSizeX(); x++) {
+            Position pos(x, y);
+            if (!board->isTileAllowingMovement(pos)) {
+                continue;
+            }
+
+            if (board->isTileCrossroad(pos) || (countPaths(pos) <= 1 && !board->isTileEdge(pos))) {
+                nodeOfTile[tileIndex(pos)] = nodes.size();
+                nodes.push_back(Node { pos, { none, none, none, none } });
+            }
+        }
+    }
+
+    // Walk corridors from each junction in each direction
+    for (uint32_t n = 0; n < nodes.size(); n++) {
+        for (size_t d = 0; d < 4; d++) {
+            Rotation exit(d);
+            if (!board->isTileAllowingMovement(nodes[n].position.movedBy(1, exit))) {
+                continue;
+            }
+
+            Approach corridor = approach(nodes[n].position, exit);
+            if (corridor.node == none) {
+                continue;
+            }
+
+            nodes[n].edges[d] = edges.size();
+            edges.push_back(Edge { n, corridor.node, exit, corridor.arrival, std::move(corridor.tiles) });
+        }
+    }
+}
+
+JunctionGraph::Approach JunctionGraph::approach(const Position & pos, const Rotation & heading) const {
+    Approach result { { }, none, heading };
+
+    Position current = board->neighbourPosition(pos, heading);
+    size_t maxSteps = nodeOfTile.size(); //< Corridor without junction would loop forever
+
+    for (size_t step = 0; step < maxSteps && board->isTileCoordinateValid(current); step++) {
+        result.tiles.push_back(tileIndex(current));
+
+        uint32_t node = nodeAt(current);
+        if (node != none) {
+            result.node = node;
+            return result;
+        }
+
+        result.arrival = corridorDirection(current, result.arrival);
+        current = board->neighbourPosition(current, result.arrival);
+    }
+
+    return result;
+}
+
+uint32_t JunctionGraph::tileIndex(const Position & pos) const {
+    return (pos.y * sizeX) + pos.x;
+}
+
+Position JunctionGraph::tilePosition(uint32_t index) const {
+    return Position(index % sizeX, index / sizeX);
+}
+
+uint32_t JunctionGraph::nodeAt(const Position & pos) const {
+    if (board == nullptr || !board->isTileCoordinateValid(pos)) {
+        return none;
+    }
+    return nodeOfTile[tileIndex(pos)];
+}
+
+const Board * JunctionGraph::getBoard() const {
+    return board;
+}
+
+const std::vector<JunctionGraph::Node> & JunctionGraph::getNodes() const {
+    return nodes;
+}
+
+const std::vector<JunctionGraph::Edge> & JunctionGraph::getEdges() const {
+    return edges;
+}
@@ -0,0 +1,161 @@
+/****************************************************************
+ * @file JunctionGraph.h
+ * @author Michal Dobes
+ * @brief Junction graph of board
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef JUNCTIONGRAPH_H
+#define JUNCTIONGRAPH_H
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "GameLogic/Board.h"
+
+/**
+ * @brief Junction graph of board
+ *
+ * Nodes of graph are junctions of board, tiles that are crossroads (see
+ * Board::isTileCrossroad) or dead ends. Edges are directed corridors between
+ * junctions, which entities follow without any decision.
+ *
+ * Corridors are walked the same way as entities move, including teleports
+ * at edges of board.
+ *
+ */
+class JunctionGraph {
+public:
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max(); //< Missing node or edge
+
+    /**
+     * @brief Directed corridor between two junctions
+     *
+     */
+    struct Edge {
+        uint32_t from; //< Node at beggining of corridor
+        uint32_t to; //< Node at end of corridor
+        Rotation exit; //< Direction in which corridor leaves node from
+        Rotation arrival; //< Direction of movement when arriving to node to
+        std::vector<uint32_t> tiles; //< Indexes of tiles of corridor after node from,
+        // last tile is the tile of node to
+    };
+
+    /**
+     * @brief Junction
+     *
+     */
+    struct Node {
+        Position position; //< Position of junction in board
+        uint32_t edges[4]; //< Edges leaving junction indexed by Rotation::Direction,
+        // none if direction doesn't allow movement
+    };
+
+    /**
+     * @brief Path from tile in corridor to next junction
+     *
+     */
+    struct Approach {
+        std::vector<uint32_t> tiles; //< Indexes of tiles until junction, last tile is
+        // the tile of junction
+        uint32_t node; //< Reached junction, none if no junction was reached
+        Rotation arrival; //< Direction of movement when arriving to junction
+    };
+
+private:
+    const Board * board; //< Board from which graph was built
+    size_t sizeX; //< Size of board in x dimension
+
+    std::vector<Node> nodes; //< Junctions
+    std::vector<Edge> edges; //< Corridors
+    std::vector<uint32_t> nodeOfTile; //< Index of node for each tile, none if tile
+    // is not junction
+
+    /**
+     * @brief Count tiles around position that allow movement
+     *
+     * @param pos position
+     * @return size_t
+     */
+    size_t countPaths(const Position & pos) const;
+
+    /**
+     * @brief Get direction in which entity in corridor continues
+     *
+     * Direction is the first one that allows movement and is not opposite
+     * to current direction, if there is no such direction, it is opposite.
+     *
+     * @param pos position in corridor
+     * @param heading current direction of movement
+     * @return Rotation
+     */
+    Rotation corridorDirection(const Position & pos, const Rotation & heading) const;
+
+public:
+    /**
+     * @brief Construct a new, empty Junction Graph object
+     *
+     */
+    JunctionGraph();
+
+    /**
+     * @brief Build graph of board
+     *
+     * Note, graph should not own the board object.
+     *
+     * @param forBoard board to build graph of
+     */
+    JunctionGraph(const Board * forBoard);
+
+    /**
+     * @brief Walk from tile in direction until junction is reached
+     *
+     * The first step is made in heading, following steps follow corridor.
+     *
+     * @param pos position to walk from
+     * @param heading direction of the first step
+     * @return Approach
+     */
+    Approach approach(const Position & pos, const Rotation & heading) const;
+
+    /**
+     * @brief Get index of tile at position
+     *
+     * @param pos position
+     * @return uint32_t
+     */
+    uint32_t tileIndex(const Position & pos) const;
+
+    /**
+     * @brief Get position of tile with index
+     *
+     * @param index index of tile
+     * @return Position
+     */
+    Position tilePosition(uint32_t index) const;
+
+    /**
+     * @brief Get node at position
+     *
+     * @param pos position
+     * @return uint32_t index of node, none if position is not a junction
+     */
+    uint32_t nodeAt(const Position & pos) const;
+
+    /**
+     * @brief Get board from which graph was built
+     *
+     * @return const Board*
+     */
+    const Board * getBoard() const;
+
+    const std::vector<Node> & getNodes() const;
+
+    const std::vector<Edge> & getEdges() const;
+};
+
+#endif /* JUNCTIONGRAPH_H */
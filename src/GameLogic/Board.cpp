@@ -59,26 +59,67 @@ std::pair<char, NCColors::ColorPairs> Board::Tile::typeDisplay(const Type & t) {
 }
 //!SECTION
 
-Board::Board() : tiles(1, 1), enemySpawn(-1, -1), playerSpawn(-1, -1), numberOfCoins(0) { }
+Board::Board() : chunked(false), tiles(1, 1), enemySpawn(-1, -1), playerSpawn(-1, -1), numberOfCoins(0) { }
 
 Board::Board(
     const Matrix<Board::Tile::Type> & newTiles,
     const Position & newEnemySpawn,
     const Position & newPlayersSpawn)
     :
-    tiles(newTiles),
+    chunked(newTiles.getSizeX() * newTiles.getSizeY() >= BOARDCHUNKEDMINTILES),
+    tiles(chunked ? Matrix<Board::Tile::Type>(1, 1) : newTiles),
     enemySpawn(newEnemySpawn),
     playerSpawn(newPlayersSpawn),
     numberOfCoins(0) {
 
+    if (chunked) {
+        chunkedTiles = ChunkedMatrix<Board::Tile::Type>(newTiles.getSizeX(), newTiles.getSizeY(), Board::Tile::Type::wall);
+        for (size_t y = 0; y < newTiles.getSizeY(); y++) {
+            for (size_t x = 0; x < newTiles.getSizeX(); x++) {
+                chunkedTiles.set(x, y, newTiles.at(x, y));
+            }
+        }
+        chunkedTiles.compact();
+    }
+
+    validateTiles();
+}
+
+Board::Board(
+    const ChunkedMatrix<Board::Tile::Type> & newTiles,
+    const Position & newEnemySpawn,
+    const Position & newPlayersSpawn)
+    :
+    chunked(newTiles.getSizeX() * newTiles.getSizeY() >= BOARDCHUNKEDMINTILES),
+    tiles(chunked ? 1 : newTiles.getSizeX(), chunked ? 1 : newTiles.getSizeY()),
+    enemySpawn(newEnemySpawn),
+    playerSpawn(newPlayersSpawn),
+    numberOfCoins(0) {
+
+    if (chunked) {
+        chunkedTiles = newTiles;
+    } else {
+        for (size_t y = 0; y < newTiles.getSizeY(); y++) {
+            for (size_t x = 0; x < newTiles.getSizeX(); x++) {
+                tiles.at(x, y) = newTiles.at(x, y);
+            }
+        }
+    }
+
+    validateTiles();
+}
+
+void Board::validateTiles() {
     if (!isTileCoordinateValid(playerSpawn) || !isTileCoordinateValid(enemySpawn)) {
         throw std::invalid_argument("Board: Board - invalid enemy or player spawn");
     }
 
     // Count amount of coins in board
-    for (size_t y = 0; y < newTiles.getSizeY(); y++) {
-        for (size_t x = 0; x < newTiles.getSizeX(); x++) {
-            if (newTiles.at(x, y) == Board::Tile::Type::coin) {
+    std::vector<Board::Tile::Type> buffer;
+    for (size_t y = 0; y < getSizeY(); y++) {
+        const Board::Tile::Type * row = tileRow(y, 0, getSizeX(), buffer);
+        for (size_t x = 0; x < getSizeX(); x++) {
+            if (row[x] == Board::Tile::Type::coin) {
                 numberOfCoins++;
             }
         }
@@ -87,6 +128,9 @@ Board::Board(
 
 Board::Tile::Type Board::tileAt(const Position & pos) const {
     try {
+        if (chunked) {
+            return chunkedTiles.at(pos.x, pos.y);
+        }
         return tiles.at(pos.x, pos.y);
     }
     catch (std::out_of_range & e) {
@@ -94,8 +138,48 @@ Board::Tile::Type Board::tileAt(const Position & pos) const {
     }
 }
 
+void Board::setTileAt(const Position & pos, const Board::Tile::Type & type) {
+    try {
+        if (chunked) {
+            chunkedTiles.set(pos.x, pos.y, type);
+        } else {
+            tiles.at(pos.x, pos.y) = type;
+        }
+    }
+    catch (std::out_of_range & e) {
+        throw BoardException("board: setTileAt - coordinates are out of range");
+    }
+}
+
+const Board::Tile::Type * Board::tileRow(
+    size_t y,
+    size_t fromX,
+    size_t count,
+    std::vector<Board::Tile::Type> & buffer) const {
+
+    if (fromX > getSizeX() || count > getSizeX() - fromX) {
+        throw BoardException("board: tileRow - row is out of range");
+    }
+
+    try {
+        if (chunked) {
+            buffer.resize(count);
+            chunkedTiles.readRow(y, fromX, count, buffer.data());
+            return buffer.data();
+        }
+        return tiles.row(y) + fromX;
+    }
+    catch (std::out_of_range & e) {
+        throw BoardException("board: tileRow - row is out of range");
+    }
+}
+
+bool Board::isChunked() const {
+    return chunked;
+}
+
 bool Board::isTileCoordinateValid(const Position & pos) const {
-    if ((size_t)(pos.x) >= tiles.getSizeX() || (size_t)(pos.y) >= tiles.getSizeY()) {
+    if ((size_t)(pos.x) >= getSizeX() || (size_t)(pos.y) >= getSizeY()) {
         return false;
     }
     return true;
@@ -158,12 +242,20 @@ Position Board::complementaryEdgePosition(Position forPos) const {
     return forPos;
 }
 
+Position Board::neighbourPosition(const Position & pos, const Rotation & inRotation) const {
+    Position next = pos.movedBy(1, inRotation);
+    if (isTileEdge(next)) {
+        next = complementaryEdgePosition(next);
+    }
+    return next;
+}
+
 size_t Board::getSizeX() const {
-    return tiles.getSizeX();
+    return chunked ? chunkedTiles.getSizeX() : tiles.getSizeX();
 }
 
 size_t Board::getSizeY() const {
-    return tiles.getSizeY();
+    return chunked ? chunkedTiles.getSizeY() : tiles.getSizeY();
 }
 
 Position Board::getEnemySpawn() const {
@@ -181,7 +273,7 @@ bool Board::interactWithTileAt(const Position & pos) {
         // decrease the number of coins
             numberOfCoins--;
         }
-        tiles.at(pos.x, pos.y) = Board::Tile::defaultType();
+        setTileAt(pos, Board::Tile::defaultType());
         return true;
     }
 
@@ -203,7 +295,7 @@ std::optional<Position> Board::placeBonusTile() {
 
         // Place bonus only if tile is of type default
         if (tileAt(tilePos) == Tile::defaultType()) {
-            tiles.at(randX, randY) = Tile::Type::bonus;
+            setTileAt(tilePos, Tile::Type::bonus);
             return tilePos;
         }
     }
@@ -17,16 +17,24 @@
 #include <list>
 #include <fstream>
 #include <optional>
+#include <vector>
 
 #include "Utilities/NCColors.h"
 #include "Structures/Transforms/Transform.h"
 #include "Structures/Matrix.h"
+#include "Structures/ChunkedMatrix.h"
+
+#define BOARDCHUNKEDMINTILES 1048576 //< Boards with at least this many tiles are stored in chunks
 
 /**
  * @brief Game Board
  *
  * Manages playing board (map) for game.
  *
+ * Tiles of small boards are stored lineary in a matrix, large boards are stored
+ * in chunks (see ChunkedMatrix), so areas of only walls or only space don't take
+ * any memory.
+ *
  */
 class Board {
 public:
@@ -38,8 +46,10 @@ public:
         /**
          * @brief Type of tile
          *
+         * Stored as single byte, so rows of tiles can be processed in bulk.
+         *
          */
-        enum class Type {
+        enum class Type : unsigned char {
             wall,
             space,
             coin,
@@ -86,13 +96,33 @@ public:
     };
 
 private:
-    Matrix<Board::Tile::Type> tiles; //< Tiles of board stored in a matrix
+    bool chunked; //< Tiles are stored in chunkedTiles instead of tiles
+    Matrix<Board::Tile::Type> tiles; //< Tiles of small board stored in a matrix
+    ChunkedMatrix<Board::Tile::Type> chunkedTiles; //< Tiles of large board stored in chunks
 
     Position enemySpawn; //< Position in maze of enemy spawn
     Position playerSpawn; //< Position in maze of player spawn
 
     unsigned int numberOfCoins; //< Current number of Coin tiles in board
 
+    /**
+     * @brief Count coins and check spawns of board
+     *
+     * @exception std::invalid_argument invalid enemy or player spawn
+     *
+     */
+    void validateTiles();
+
+    /**
+     * @brief Set tile at position in board
+     *
+     * @exception BoardException wrong position
+     *
+     * @param pos position of tile
+     * @param type new type of tile
+     */
+    void setTileAt(const Position & pos, const Board::Tile::Type & type);
+
 public:
 
     /**
@@ -104,6 +134,10 @@ public:
     /**
      * @brief Construct a new Board object
      *
+     * If matrix has at least BOARDCHUNKEDMINTILES tiles, tiles are moved to chunks.
+     *
+     * @exception std::invalid_argument invalid enemy or player spawn
+     *
      * @param newTiles Matrix of tiles
      * @param newEnemySpawn Position of enemy spawn
      * @param newPlayersSpawn Position of player spawn
@@ -113,6 +147,22 @@ public:
         const Position & newEnemySpawn,
         const Position & newPlayersSpawn);
 
+    /**
+     * @brief Construct a new Board object from chunks
+     *
+     * If matrix has less than BOARDCHUNKEDMINTILES tiles, tiles are moved to matrix.
+     *
+     * @exception std::invalid_argument invalid enemy or player spawn
+     *
+     * @param newTiles Chunked matrix of tiles
+     * @param newEnemySpawn Position of enemy spawn
+     * @param newPlayersSpawn Position of player spawn
+     */
+    Board(
+        const ChunkedMatrix<Board::Tile::Type> & newTiles,
+        const Position & newEnemySpawn,
+        const Position & newPlayersSpawn);
+
     /**
      * @brief Get tile at position in board
      *
@@ -132,6 +182,35 @@ public:
      */
     bool isTileCoordinateValid(const Position & pos) const;
 
+    /**
+     * @brief Get tiles of part of row in board
+     *
+     * Returned tiles are stored lineary. If board is stored in matrix, pointer
+     * into board is returned, else tiles are copied into buffer.
+     *
+     * @exception BoardException wrong row or part of row
+     *
+     * @param y row of board
+     * @param fromX first tile of part of row
+     * @param count number of tiles in part of row
+     * @param buffer buffer for tiles, which might be used
+     * @return const Board::Tile::Type* first tile of part of row, valid until
+     *      board or buffer changes
+     */
+    const Board::Tile::Type * tileRow(
+        size_t y,
+        size_t fromX,
+        size_t count,
+        std::vector<Board::Tile::Type> & buffer) const;
+
+    /**
+     * @brief Check if board is stored in chunks
+     *
+     * @return true
+     * @return false
+     */
+    bool isChunked() const;
+
     /**
      * @brief Check if tile at position is a crossroad
      *
@@ -171,6 +250,18 @@ public:
      */
     Position complementaryEdgePosition(Position forPos) const;
 
+    /**
+     * @brief Get position of tile next to position in direction
+     *
+     * If next tile is at edge of board, it is a teleport and complementary
+     * position on opposite edge is returned (the same way entities move).
+     *
+     * @param pos position
+     * @param inRotation direction of next tile
+     * @return Position position of next tile
+     */
+    Position neighbourPosition(const Position & pos, const Rotation & inRotation) const;
+
     /**
      * @brief Get the size of board in X dimension
      *
@@ -0,0 +1,341 @@
+#include "GameLogic/Entities/Enemies.h"
+#include "GameLogic/Entities/Ghosts/Ghosts.h"
+
+bool Enemies::hasFlag(size_t i, Flag flag) const {
+    return (flags[i] & flag) != 0;
+}
+
+void Enemies::toggleFlag(size_t i, Flag flag) {
+    flags[i] ^= flag;
+}
+
+void Enemies::calculateNextDirection(size_t i, const Board & board, const Position & target, FlowFields * flowFields) {
+    const Rotation & currentDirection = currentDirections[i];
+    Rotation & nextRotation = nextRotations[i];
+
+    Position nextTilePos = positions[i].movedBy(1, currentDirection); //< Get tile to
+    // which enemy will move to on next move
+
+    // If next tile is at edge, it is a teleport and position behind teleport should be 
+    // used to calculate nextRotation
+    if (board.isTileEdge(nextTilePos)) {
+        nextTilePos = board.complementaryEdgePosition(nextTilePos);
+    }
+
+    // If next tile is crossroad and flow fields are used, choose direction to tile
+    // with lowest distance in field (first direction on tie, same as sorting below)
+    if (flowFields && board.isTileCrossroad(nextTilePos)) {
+        FlowFields::Field & field = flowFields->fieldTo(target);
+
+        uint32_t bestDistance = FlowFields::unreachable;
+        for (size_t d = 0; d < 4; d++) {
+            Rotation processingRotation(d);
+            if (processingRotation == currentDirection.opposite()) {
+                continue;
+            }
+
+            Position calculatePosition = board.neighbourPosition(nextTilePos, processingRotation);
+            uint32_t distance = flowFields->distanceIn(field, calculatePosition);
+            if (board.isTileAllowingMovement(calculatePosition) && distance < bestDistance) {
+                bestDistance = distance;
+                nextRotation = processingRotation;
+            }
+        }
+
+        // If target can't be reached from any direction, use straight distance
+        if (bestDistance != FlowFields::unreachable) {
+            return;
+        }
+    }
+
+    // If next tile is crossroad
+    if (board.isTileCrossroad(nextTilePos)) {
+        std::vector<std::pair<double, Rotation>> distances;
+
+        // Check in every direction except for tile enemy is currently on and
+        // calculate distance from each tile to target
+        for (size_t d = 0; d < 4; d++) {
+            Rotation processingRotation(d);
+            Position calculatePosition = nextTilePos.movedBy(1, processingRotation);
+            if (!board.isTileAllowingMovement(calculatePosition)
+                || (processingRotation == currentDirection.opposite())) {
+                continue;
+            }
+
+            if (board.isTileEdge(calculatePosition)) {
+                calculatePosition = board.complementaryEdgePosition(calculatePosition);
+            }
+
+            // Calculate distance
+            distances.push_back(std::make_pair(Position::distanceBetween(target, calculatePosition), processingRotation));
+        }
+
+        // Sort tiles by lowest distance
+        std::sort(distances.begin(), distances.end(), [ ](auto & lhs, auto & rhs) {
+            return std::tie(lhs.first, lhs.second) < std::tie(rhs.first, rhs.second);
+            });
+
+        // If intelligence is low, enemy will choose non-ideal path in 1/4 times
+        if (intelligence == 0) {
+            srand(time(0));
+            if ((rand() % 4) == 0) {
+                nextRotation = distances.back().second;
+                return;
+            }
+        }
+
+        // Else set direction to tile which has smallest distance to target
+        nextRotation = distances.front().second;
+        return;
+    }
+
+    // If not at crossroad, find the direction in which it is possible to move
+    // except for tile enemy is currently on
+    for (size_t d = 0; d < 4; d++) {
+        Rotation processingRotation(d);
+        Position calculatePosition = nextTilePos.movedBy(1, processingRotation);
+
+        if (board.isTileAllowingMovement(calculatePosition)
+            && (processingRotation != currentDirection.opposite())) {
+            nextRotation = processingRotation;
+            return;
+        }
+    }
+
+    // If movement is possible in no other direction, turn around
+    nextRotation = currentDirection.opposite();
+}
+
+Position Enemies::calculateTarget(
+    size_t i,
+    const Board & board,
+    const Transform & playerTransform,
+    const Position & specialPos) const {
+    if (hasFlag(i, frightened)) {
+
+        // Different frightened targets based on intelligence
+        if (intelligence == 0) { // If intelligence is low, move behind player
+            Position behindPlayer = playerTransform.position;
+            behindPlayer.moveBy(4, playerTransform.rotation.opposite());
+            return behindPlayer;
+        } else if (intelligence == 1) { // If intelligence is medium, move to random position
+            srand(time(0));
+            size_t randX = rand() % (board.getSizeX());
+            size_t randY = rand() % (board.getSizeY());
+            return Position(randX, randY);
+        }
+
+        // If intelligence is high, move to quadrant of board that is opposite to 
+        // the quadrant in which is player
+
+        Position frightenTarget;
+        // x coord calculation
+        if ((unsigned long)(playerTransform.position.x) < board.getSizeX()) {
+            frightenTarget.x = board.getSizeX();
+        } else {
+            frightenTarget.x = 0;
+        }
+
+        // y coord calculation
+        if ((unsigned long)(playerTransform.position.y) < board.getSizeY()) {
+            frightenTarget.y = board.getSizeY();
+        } else {
+            frightenTarget.y = 0;
+        }
+
+        return frightenTarget;
+
+    } else if (hasFlag(i, scatter)) {
+        return scatterTargets[i];
+    }
+
+    // Chase target is specific to type of enemy
+    switch (types[i]) {
+        case Type::blinky:
+            return GhostBlinky::chaseTarget(playerTransform, positions[i], scatterTargets[i], specialPos);
+        case Type::pinky:
+            return GhostPinky::chaseTarget(playerTransform, positions[i], scatterTargets[i], specialPos);
+        case Type::inky:
+            return GhostInky::chaseTarget(playerTransform, positions[i], scatterTargets[i], specialPos);
+        case Type::clyde:
+            return GhostClyde::chaseTarget(playerTransform, positions[i], scatterTargets[i], specialPos);
+    }
+    return Position();
+}
+
+Enemies::Enemies(unsigned int intelligenceLevel) : intelligence(intelligenceLevel) { }
+
+std::optional<Enemies::Type> Enemies::typeFromName(const std::string & name) {
+    for (Type t : { Type::blinky, Type::pinky, Type::inky, Type::clyde }) {
+        if (typeName(t) == name) {
+            return t;
+        }
+    }
+    return { };
+}
+
+std::string Enemies::typeName(Type type) {
+    switch (type) {
+        case Type::blinky:
+            return "blinky";
+        case Type::pinky:
+            return "pinky";
+        case Type::inky:
+            return "inky";
+        case Type::clyde:
+            return "clyde";
+    }
+    return "";
+}
+
+size_t Enemies::add(Type type, const Transform & initial, const Position & scatterPos, bool a) {
+    types.push_back(type);
+    positions.push_back(initial.position);
+    rotations.push_back(initial.rotation);
+    currentDirections.push_back(initial.rotation);
+    nextRotations.push_back(initial.rotation);
+    scatterTargets.push_back(scatterPos);
+    flags.push_back(a ? alive : 0);
+    plannedTargets.emplace_back();
+    return types.size() - 1;
+}
+
+void Enemies::clear() {
+    types.clear();
+    positions.clear();
+    rotations.clear();
+    currentDirections.clear();
+    nextRotations.clear();
+    scatterTargets.clear();
+    flags.clear();
+    plannedTargets.clear();
+}
+
+size_t Enemies::size() const {
+    return types.size();
+}
+
+void Enemies::advance(size_t i, const Board & board) {
+    if (!hasFlag(i, alive)) {
+        return;
+    }
+
+    // Rotation of enemy's transform reflects rotation of the previous movement.
+
+    // Set rotation to current direction and move in this direction,
+    // then set current direction to next rotation
+    rotations[i] = currentDirections[i];
+    positions[i] = advancedPosition(i, board);
+    currentDirections[i] = nextRotations[i];
+}
+
+Position Enemies::advancedPosition(size_t i, const Board & board) const {
+    Position next = positions[i].movedBy(1, currentDirections[i]);
+
+    //If at edge, teleport to the other side
+    if (board.isTileEdge(next)) {
+        next = board.complementaryEdgePosition(next);
+    }
+    return next;
+}
+
+void Enemies::steer(
+    size_t i,
+    const Board & board,
+    const Transform & playerTransform,
+    const Position & specialPos,
+    FlowFields * flowFields) {
+    if (!hasFlag(i, alive)) {
+        return;
+    }
+
+    // Calculate new next rotation
+    Position target;
+    if (plannedTargets[i] && !hasFlag(i, frightened) && !hasFlag(i, scatter)) {
+        target = *plannedTargets[i];
+    } else {
+        target = calculateTarget(i, board, playerTransform, specialPos);
+    }
+    plannedTargets[i].reset();
+
+    calculateNextDirection(i, board, target, flowFields);
+}
+
+void Enemies::setPlannedTarget(size_t i, const std::optional<Position> & target) {
+    plannedTargets[i] = target;
+}
+
+void Enemies::reposition(size_t i, const Transform & trans) {
+    positions[i] = trans.position;
+    rotations[i] = trans.rotation;
+}
+
+Transform Enemies::getTransform(size_t i) const {
+    return Transform(positions[i], rotations[i]);
+}
+
+const Position & Enemies::getPosition(size_t i) const {
+    return positions[i];
+}
+
+Rotation Enemies::getCurrentDirection(size_t i) const {
+    return currentDirections[i];
+}
+
+Rotation Enemies::getNextRotation(size_t i) const {
+    return nextRotations[i];
+}
+
+Enemies::Type Enemies::getType(size_t i) const {
+    return types[i];
+}
+
+void Enemies::toggleAlive(size_t i) {
+    toggleFlag(i, alive);
+}
+
+bool Enemies::isAlive(size_t i) const {
+    return hasFlag(i, alive);
+}
+
+bool Enemies::isScattering(size_t i) const {
+    return hasFlag(i, scatter);
+}
+
+void Enemies::toggleScatter(size_t i, const Board & board) {
+    //If not frightened and not at edge, turn around
+    if (!hasFlag(i, frightened) && !board.isTileEdge(positions[i])) {
+        nextRotations[i] = currentDirections[i].opposite();
+    }
+    toggleFlag(i, scatter);
+}
+
+void Enemies::toggleFrighten(size_t i, const Board & board) {
+    //If toggling frighten off and not at edge, turn around
+    if (!hasFlag(i, frightened) && !board.isTileEdge(positions[i])) {
+        nextRotations[i] = currentDirections[i].opposite();
+    }
+    toggleFlag(i, frightened);
+}
+
+bool Enemies::isFrightened(size_t i) const {
+    return hasFlag(i, frightened);
+}
+
+std::pair<char, NCColors::ColorPairs> Enemies::displayEntity(size_t i) const {
+    if (hasFlag(i, frightened)) {
+        return std::make_pair('&', NCColors::ColorPairs::ghostFrighten);
+    }
+
+    switch (types[i]) {
+        case Type::blinky:
+            return GhostBlinky::displayEntity();
+        case Type::pinky:
+            return GhostPinky::displayEntity();
+        case Type::inky:
+            return GhostInky::displayEntity();
+        case Type::clyde:
+            return GhostClyde::displayEntity();
+    }
+    return std::make_pair('&', NCColors::ColorPairs::basic);
+}
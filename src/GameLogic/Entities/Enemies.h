@@ -0,0 +1,329 @@
+/****************************************************************
+ * @file Enemies.h
+ * @author Michal Dobes
+ * @brief Model of enemies
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+*****************************************************************/
+
+#ifndef ENEMIES_H
+#define ENEMIES_H
+
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <optional>
+#include <string>
+
+#include "Structures/Transforms/Transform.h"
+#include "Utilities/NCColors.h"
+#include "GameLogic/Board.h"
+#include "GameLogic/AI/FlowFields.h"
+
+/**
+ * @brief Enemy entities
+ *
+ * Enemies are stored as structure of arrays, each enemy is an index into arrays
+ * of its values. Behaviour specific to type of enemy (target in chase mode and
+ * display) is chosen by type tag of enemy, see ghost types in Ghosts.h.
+ *
+ */
+class Enemies {
+public:
+    /**
+     * @brief Types of enemies
+     *
+     */
+    enum class Type : unsigned char {
+        blinky,
+        pinky,
+        inky,
+        clyde
+    };
+
+private:
+    /**
+     * @brief Bits of mode flags of enemy
+     *
+     */
+    enum Flag : unsigned char {
+        alive = 1,
+        frightened = 2,
+        scatter = 4
+    };
+
+    unsigned int intelligence; //< Intelligence level of all enemies
+
+    std::vector<Type> types; //< Type of each enemy
+    std::vector<Position> positions; //< Current position of each enemy
+    std::vector<Rotation> rotations; //< Rotation of previous movement of each enemy
+    std::vector<Rotation> currentDirections; //< Rotation of next movement of each enemy
+    std::vector<Rotation> nextRotations; //< Rotation of movement after next movement
+    std::vector<Position> scatterTargets; //< Target of each enemy in scatter mode
+    std::vector<unsigned char> flags; //< Mode flags of each enemy
+    std::vector<std::optional<Position>> plannedTargets; //< Target chosen by planner for
+    // next chase movement of each enemy
+
+    /**
+     * @brief Is flag of enemy set
+     *
+     * @param i index of enemy
+     * @param flag flag
+     * @return true
+     * @return false
+     */
+    bool hasFlag(size_t i, Flag flag) const;
+
+    /**
+     * @brief Toggle flag of enemy
+     *
+     * @param i index of enemy
+     * @param flag flag
+     */
+    void toggleFlag(size_t i, Flag flag);
+
+    /**
+     * @brief Calculate next direction of movement of enemy
+     *
+     * Changes next rotation, based on tile that is pointed to by current direction
+     *
+     * Flowchart of steps used in calculating next direction:
+     * @image html nextdirection.png
+     *
+     * If flow fields are given, distances at crossroad are looked up in flow field
+     * to target instead of using straight distance.
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     * @param target Target to which enemy wants to move to
+     * @param flowFields Shared flow fields of current movement, nullptr if not used
+     */
+    void calculateNextDirection(size_t i, const Board & board, const Position & target, FlowFields * flowFields);
+
+    /**
+     * @brief Calculate target to which enemy wants to move to
+     *
+     * Target in chase mode is chosen by type of enemy.
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     * @param playerTransform Transform of player
+     * @param specialPos Special position to use in calculation
+     * @return Position
+     */
+    Position calculateTarget(
+        size_t i,
+        const Board & board,
+        const Transform & playerTransform,
+        const Position & specialPos) const;
+
+public:
+
+    /**
+     * @brief Construct a new, empty Enemies object
+     *
+     * @param intelligenceLevel Level of intelligence of enemies
+     */
+    Enemies(unsigned int intelligenceLevel = 1);
+
+    /**
+     * @brief Get type of enemy from its name
+     *
+     * Names are lowercase names of ghosts ("blinky", "pinky", "inky", "clyde").
+     *
+     * @param name name of type
+     * @return std::optional<Type> empty if there is no type with name
+     */
+    static std::optional<Type> typeFromName(const std::string & name);
+
+    /**
+     * @brief Get name of type of enemy
+     *
+     * @param type type
+     * @return std::string
+     */
+    static std::string typeName(Type type);
+
+    /**
+     * @brief Add enemy
+     *
+     * @param type Type of enemy
+     * @param initial Initial transform
+     * @param scatterPos Target in scatter mode
+     * @param a Is alive
+     * @return size_t index of added enemy
+     */
+    size_t add(Type type, const Transform & initial, const Position & scatterPos, bool a = false);
+
+    /**
+     * @brief Remove all enemies
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Amount of enemies
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Move enemy in its current direction
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     */
+    void advance(size_t i, const Board & board);
+
+    /**
+     * @brief Get position enemy reaches by its next advance
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     * @return Position
+     */
+    Position advancedPosition(size_t i, const Board & board) const;
+
+    /**
+     * @brief Calculate next direction of movement of enemy
+     *
+     * If target was planned for this movement and enemy is chasing, planned target
+     * is used instead of calculated one.
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     * @param playerTransform Transform of player
+     * @param specialPos Special position to use in calculation of target
+     * @param flowFields Shared flow fields of current movement, nullptr if straight
+     *      distance to target should be used
+     */
+    void steer(
+        size_t i,
+        const Board & board,
+        const Transform & playerTransform,
+        const Position & specialPos = Position(),
+        FlowFields * flowFields = nullptr);
+
+    /**
+     * @brief Set target of enemy for next calculation of direction
+     *
+     * @param i index of enemy
+     * @param target target, empty if target should be calculated
+     */
+    void setPlannedTarget(size_t i, const std::optional<Position> & target);
+
+    /**
+     * @brief Set transform of enemy
+     *
+     * @param i index of enemy
+     * @param trans transform
+     */
+    void reposition(size_t i, const Transform & trans);
+
+    /**
+     * @brief Get transform of enemy
+     *
+     * Rotation of transform is rotation of previous movement.
+     *
+     * @param i index of enemy
+     * @return Transform
+     */
+    Transform getTransform(size_t i) const;
+
+    /**
+     * @brief Get position of enemy
+     *
+     * @param i index of enemy
+     * @return const Position&
+     */
+    const Position & getPosition(size_t i) const;
+
+    /**
+     * @brief Get direction of next movement of enemy
+     *
+     * @param i index of enemy
+     * @return Rotation
+     */
+    Rotation getCurrentDirection(size_t i) const;
+
+    /**
+     * @brief Get direction of movement after next movement of enemy
+     *
+     * @param i index of enemy
+     * @return Rotation
+     */
+    Rotation getNextRotation(size_t i) const;
+
+    /**
+     * @brief Get type of enemy
+     *
+     * @param i index of enemy
+     * @return Type
+     */
+    Type getType(size_t i) const;
+
+    /**
+     * @brief Toggle alive on/off on enemy
+     *
+     * @param i index of enemy
+     */
+    void toggleAlive(size_t i);
+
+    /**
+     * @brief Is enemy alive
+     *
+     * @param i index of enemy
+     * @return true
+     * @return false
+     */
+    bool isAlive(size_t i) const;
+
+    /**
+     * @brief Is enemy in scatter mode
+     *
+     * @param i index of enemy
+     * @return true
+     * @return false
+     */
+    bool isScattering(size_t i) const;
+
+    /**
+     * @brief Toggle on/off scatter mode on enemy
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     */
+    void toggleScatter(size_t i, const Board & board);
+
+    /**
+     * @brief Togle on/off frighten mode on enemy
+     *
+     * @param i index of enemy
+     * @param board Board in which enemies are moving in
+     */
+    void toggleFrighten(size_t i, const Board & board);
+
+    /**
+     * @brief Is enemy in frighten mode
+     *
+     * @param i index of enemy
+     * @return true
+     * @return false
+     */
+    bool isFrightened(size_t i) const;
+
+    /**
+     * @brief Get display information of enemy
+     *
+     * @param i index of enemy
+     * @return std::pair<char, NCColors::ColorPairs> character and color
+     */
+    std::pair<char, NCColors::ColorPairs> displayEntity(size_t i) const;
+};
+
+#endif /* ENEMIES_H */
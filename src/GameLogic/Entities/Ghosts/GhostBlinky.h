@@ -1,7 +1,7 @@
 /****************************************************************
  * @file GhostBlinky.h
  * @author Michal Dobes
- * @brief Model of enemy ghost "Blinky"
+ * @brief Behaviour of enemy ghost "Blinky"
  * @date 2022-05-25
  *
  * @copyright Copyright (c) 2022
@@ -11,39 +11,38 @@
 #ifndef GHOSTBLINKY_H
 #define GHOSTBLINKY_H
 
-#include "GameLogic/Entities/Enemy.h"
+#include <tuple>
+
+#include "Structures/Transforms/Transform.h"
+#include "Utilities/NCColors.h"
 
 /**
  * @brief Enemy ghost "Blinky"
  *
  * Ghost Blinky uses player's position as it's target.
  */
-class GhostBlinky : public Enemy {
-public:
-
+struct GhostBlinky {
     /**
-     * @brief Construct a new Ghost Blinky object
+     * @brief Calculate target of ghost in chase mode
      *
-     * @param initial Initial transform
-     * @param scatterPos Scatter target
-     * @param intelligence Intelligence level
-     * @param a Alive
+     * @param playerTransform Transform of player
+     * @param ghostPosition Position of ghost
+     * @param scatterPos Scatter target of ghost
+     * @param specialPos Special position to use in calculation
+     * @return Position
      */
-    GhostBlinky(
-        const Transform & initial,
+    static Position chaseTarget(
+        const Transform & playerTransform,
+        const Position & ghostPosition,
         const Position & scatterPos,
-        unsigned int intelligence = 1,
-        bool a = false);
+        const Position & specialPos);
 
     /**
-     * @brief Destroy the Ghost Blinky object
+     * @brief Get display information of ghost when not frightened
      *
+     * @return std::pair<char, NCColors::ColorPairs> character and color
      */
-    ~GhostBlinky();
-
-    Position calculateTarget(const Board & board, const Transform & playerTransform, const Position &) override;
-
-    std::pair<char, NCColors::ColorPairs> displayEntity() override;
+    static std::pair<char, NCColors::ColorPairs> displayEntity();
 };
 
 #endif /* GHOSTBLINKY_H */
\ No newline at end of file
@@ -1,26 +1,16 @@
 #include "GameLogic/Entities/Ghosts/GhostClyde.h"
 
-GhostClyde::GhostClyde(
-    const Transform & initial,
+Position GhostClyde::chaseTarget(
+    const Transform & playerTransform,
+    const Position & ghostPosition,
     const Position & scatterPos,
-    unsigned int intelligence, bool a) : Enemy(initial, scatterPos, a, intelligence) { }
-
-GhostClyde::~GhostClyde() { }
-
-Position GhostClyde::calculateTarget(const Board & board, const Transform & playerTransform, const Position &) {
-    if (frightened || scatter) {
-        return Enemy::calculateTarget(board, playerTransform);
-    }
-
-    if (Position::distanceBetween(playerTransform.position, transform.position) > 8.0) {
+    const Position &) {
+    if (Position::distanceBetween(playerTransform.position, ghostPosition) > 8.0) {
         return playerTransform.position;
     }
-    return scatterTarget;
+    return scatterPos;
 }
 
 std::pair<char, NCColors::ColorPairs> GhostClyde::displayEntity() {
-    if (frightened) {
-        return Enemy::displayEntity();
-    }
     return std::make_pair('&', NCColors::ColorPairs::ghostClyde);
-}
\ No newline at end of file
+}
@@ -1,7 +1,7 @@
 /****************************************************************
  * @file GhostClyde.h
  * @author Michal Dobes
- * @brief Model of enemy ghost "Clyde"
+ * @brief Behaviour of enemy ghost "Clyde"
  * @date 2022-05-25
  *
  * @copyright Copyright (c) 2022
@@ -11,7 +11,10 @@
 #ifndef GHOSTCLYDE_H
 #define GHOSTCLYDE_H
 
-#include "GameLogic/Entities/Enemy.h"
+#include <tuple>
+
+#include "Structures/Transforms/Transform.h"
+#include "Utilities/NCColors.h"
 
 /**
  * @brief Enemy ghost "Clyde"
@@ -19,32 +22,28 @@
  * Ghost Clyde uses player's position as target if Clyde's distance to player is
  * more than 8 tiles, else Clyde uses it's scatter position.
  */
-class GhostClyde : public Enemy {
-public:
-
+struct GhostClyde {
     /**
-     * @brief Construct a new Ghost Clyde object
+     * @brief Calculate target of ghost in chase mode
      *
-     * @param initial Initial transform
-     * @param scatterPos Scatter target
-     * @param intelligence Intelligence level
-     * @param a Alive
+     * @param playerTransform Transform of player
+     * @param ghostPosition Position of ghost
+     * @param scatterPos Scatter target of ghost
+     * @param specialPos Special position to use in calculation
+     * @return Position
      */
-    GhostClyde(
-        const Transform & initial,
+    static Position chaseTarget(
+        const Transform & playerTransform,
+        const Position & ghostPosition,
         const Position & scatterPos,
-        unsigned int intelligence = 1,
-        bool a = false);
+        const Position & specialPos);
 
     /**
-     * @brief Destroy the Ghost Clyde object
-     * 
+     * @brief Get display information of ghost when not frightened
+     *
+     * @return std::pair<char, NCColors::ColorPairs> character and color
      */
-    ~GhostClyde();
-
-    Position calculateTarget(const Board & board, const Transform & playerTransform, const Position &) override;
-
-    std::pair<char, NCColors::ColorPairs> displayEntity() override;
+    static std::pair<char, NCColors::ColorPairs> displayEntity();
 };
 
 #endif /* GHOSTCLYDE_H */
\ No newline at end of file
@@ -1,21 +1,10 @@
 #include "GameLogic/Entities/Ghosts/GhostInky.h"
 
-GhostInky::GhostInky(
-    const Transform & initial,
-    const Position & scatterPos,
-    unsigned int intelligence,
-    bool a) : Enemy(initial, scatterPos, a, intelligence) { }
-
-GhostInky::~GhostInky() { }
-
-Position GhostInky::calculateTarget(
-    const Board & board,
+Position GhostInky::chaseTarget(
     const Transform & playerTransform,
+    const Position &,
+    const Position &,
     const Position & specialPos) {
-    if (frightened || scatter) {
-        return Enemy::calculateTarget(board, playerTransform);
-    }
-
     Position newTarget(playerTransform.position);
     newTarget.movedBy(2, playerTransform.rotation); //< Move player's position in its direction by 2 tiles
     Position playerMoved = newTarget;
@@ -32,8 +21,5 @@ Position GhostInky::calculateTarget(
 }
 
 std::pair<char, NCColors::ColorPairs> GhostInky::displayEntity() {
-    if (frightened) {
-        return Enemy::displayEntity();
-    }
     return std::make_pair('&', NCColors::ColorPairs::ghostInky);
-}
\ No newline at end of file
+}
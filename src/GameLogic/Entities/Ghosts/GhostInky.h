@@ -1,7 +1,7 @@
 /****************************************************************
  * @file GhostInky.h
  * @author Michal Dobes
- * @brief Model of enemy ghost "Inky"
+ * @brief Behaviour of enemy ghost "Inky"
  * @date 2022-05-25
  *
  * @copyright Copyright (c) 2022
@@ -11,7 +11,10 @@
 #ifndef GHOSTINKY_H
 #define GHOSTINKY_H
 
-#include "GameLogic/Entities/Enemy.h"
+#include <tuple>
+
+#include "Structures/Transforms/Transform.h"
+#include "Utilities/NCColors.h"
 
 /**
  * @brief Enemy ghost "Inky"
@@ -21,35 +24,28 @@
  * and the other entity, so that the other entity's position is exactly halfway
  * between Inky's target position and the player.
  */
-class GhostInky : public Enemy {
-public:
-
+struct GhostInky {
     /**
-     * @brief Construct a new Ghost Inky object
+     * @brief Calculate target of ghost in chase mode
      *
-     * @param initial Initial transform
-     * @param scatterPos Scatter target
-     * @param intelligence Intelligence level
-     * @param a Alive
+     * @param playerTransform Transform of player
+     * @param ghostPosition Position of ghost
+     * @param scatterPos Scatter target of ghost
+     * @param specialPos Special position to use in calculation
+     * @return Position
      */
-    GhostInky(
-        const Transform & initial,
+    static Position chaseTarget(
+        const Transform & playerTransform,
+        const Position & ghostPosition,
         const Position & scatterPos,
-        unsigned int intelligence = 1,
-        bool a = false);
+        const Position & specialPos);
 
     /**
-     * @brief Destroy the Ghost Inky object
-     * 
+     * @brief Get display information of ghost when not frightened
+     *
+     * @return std::pair<char, NCColors::ColorPairs> character and color
      */
-    ~GhostInky();
-
-    Position calculateTarget(
-        const Board & board,
-        const Transform & playerTransform,
-        const Position & specialPos) override;
-
-    std::pair<char, NCColors::ColorPairs> displayEntity() override;
+    static std::pair<char, NCColors::ColorPairs> displayEntity();
 };
 
 #endif /* GHOSTINKY_H */
\ No newline at end of file
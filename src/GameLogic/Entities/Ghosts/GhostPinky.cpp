@@ -1,17 +1,10 @@
 #include "GameLogic/Entities/Ghosts/GhostPinky.h"
 
-GhostPinky::GhostPinky(
-    const Transform & initial,
-    const Position & scatterPos,
-    unsigned int intelligence,
-    bool a) : Enemy(initial, scatterPos, a, intelligence) { }
-GhostPinky::~GhostPinky() { }
-
-Position GhostPinky::calculateTarget(const Board & board, const Transform & playerTransform, const Position &) {
-    if (frightened || scatter) {
-        return Enemy::calculateTarget(board, playerTransform);
-    }
-
+Position GhostPinky::chaseTarget(
+    const Transform & playerTransform,
+    const Position &,
+    const Position &,
+    const Position &) {
     Position newTarget(playerTransform.position);
     newTarget.moveBy(4, playerTransform.rotation);
     if (playerTransform.rotation.direction == Rotation::Direction::up) {
@@ -21,8 +14,5 @@ Position GhostPinky::calculateTarget(const Board & board, const Transform & play
 }
 
 std::pair<char, NCColors::ColorPairs> GhostPinky::displayEntity() {
-    if (frightened) {
-        return Enemy::displayEntity();
-    }
     return std::make_pair('&', NCColors::ColorPairs::ghostPinky);
-}
\ No newline at end of file
+}
@@ -1,7 +1,7 @@
 /****************************************************************
  * @file GhostPinky.h
  * @author Michal Dobes
- * @brief Model of enemy ghost "Pinky"
+ * @brief Behaviour of enemy ghost "Pinky"
  * @date 2022-05-25
  *
  * @copyright Copyright (c) 2022
@@ -11,7 +11,10 @@
 #ifndef GHOSTPINKY_H
 #define GHOSTPINKY_H
 
-#include "GameLogic/Entities/Enemy.h"
+#include <tuple>
+
+#include "Structures/Transforms/Transform.h"
+#include "Utilities/NCColors.h"
 
 /**
  * @brief Enemy ghost "Pinky"
@@ -19,32 +22,28 @@
  * Ghost Pinky's target position is 4 tiles in front of player. If player is
  * heading up, then Pinky's target position is shifted additional 4 tiles to left.
  */
-class GhostPinky : public Enemy {
-public:
-
+struct GhostPinky {
     /**
-     * @brief Construct a new Ghost Pinky object
+     * @brief Calculate target of ghost in chase mode
      *
-     * @param initial Initial transform
-     * @param scatterPos Scatter target
-     * @param intelligence Intelligence level
-     * @param a Alive
+     * @param playerTransform Transform of player
+     * @param ghostPosition Position of ghost
+     * @param scatterPos Scatter target of ghost
+     * @param specialPos Special position to use in calculation
+     * @return Position
      */
-    GhostPinky(
-        const Transform & initial,
+    static Position chaseTarget(
+        const Transform & playerTransform,
+        const Position & ghostPosition,
         const Position & scatterPos,
-        unsigned int intelligence = 1,
-        bool a = false);
+        const Position & specialPos);
 
     /**
-     * @brief Destroy the Ghost Pinky object
-     * 
+     * @brief Get display information of ghost when not frightened
+     *
+     * @return std::pair<char, NCColors::ColorPairs> character and color
      */
-    ~GhostPinky();
-
-    Position calculateTarget(const Board & board, const Transform & playerTransform, const Position &) override;
-
-    std::pair<char, NCColors::ColorPairs> displayEntity() override;
+    static std::pair<char, NCColors::ColorPairs> displayEntity();
 };
 
 #endif /* GHOSTPINKY_H */
\ No newline at end of file
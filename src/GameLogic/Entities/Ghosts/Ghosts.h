@@ -1,7 +1,7 @@
 /****************************************************************
  * @file Ghosts.h
  * @author Michal Dobes
- * @brief Include Models of enemy ghosts
+ * @brief Include behaviours of enemy ghosts
  * @date 2022-05-25
  *
  * @copyright Copyright (c) 2022
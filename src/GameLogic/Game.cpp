@@ -1,9 +1,13 @@
+#include <algorithm>
 #include <iostream>
 
 #include "GameLogic/Game.h"
 #include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/Profiler.h"
 
 void Game::detectCollisions() {
+    Profiler::Scope profile(Profiler::detectCollisions);
+
     Position playerPos = player->getTransform().position;
     Board::Tile::Type playerTile = board->tileAt(playerPos);
 
@@ -25,32 +29,38 @@ void Game::detectCollisions() {
         }
 
         board->interactWithTileAt(playerPos); //< Replace tile in board after interaction
+        diffRedraw.push_back(playerPos); //< Add replaced tile into diffRedraw
         needsRedraw = true;
     }
 
-    // Check for collision of player and enemy
-    for (auto & e : ghosts) {
-        if (!e->isAlive()) {
+    // Check for collision of player and enemy, only if some entity moved
+    if (!entitiesMoved) {
+        return;
+    }
+    entitiesMoved = false;
+
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (!ghosts.isAlive(i)) {
             continue;
         }
 
-        if (playerPos == e->getTransform().position) {
-            if (e->isFrightened()) { //< If enemy is frightned, kill enemy and reset it
-                diffRedraw.push_back(e->getTransform().position); //< Add previous position 
+        if (playerPos == ghosts.getPosition(i)) {
+            if (ghosts.isFrightened(i)) { //< If enemy is frightned, kill enemy and reset it
+                diffRedraw.push_back(ghosts.getPosition(i)); //< Add previous position 
                  // of enemy into diffRedraw
-                e->toggleAlive();
-                if (e->isFrightened()) {
-                    e->toggleFrighten(*board);
+                ghosts.toggleAlive(i);
+                if (ghosts.isFrightened(i)) {
+                    ghosts.toggleFrighten(i, *board);
                 }
-                e->reposition(board->getEnemySpawn());
+                ghosts.reposition(i, board->getEnemySpawn());
 
                 // Add timer trigger for enemy respawn
-                Enemy * ePtr = e.get();
                 timer.addTrigger(
                     settings.killDuration,
-                    [ ePtr ]() {
-                        ePtr->toggleAlive();
-                    });
+                    [ this, i ]() {
+                        this->ghosts.toggleAlive(i);
+                        this->entitiesMoved = true;
+                    }, false, "respawn enemy");
 
                 score += (200 * (killStreak + 1)); //< Raise score by multiplied by Killstreak
                 killStreak++;
@@ -63,8 +73,8 @@ void Game::detectCollisions() {
 
                 // Add positions of all entities into diffRedraw
                 diffRedraw.push_back(playerPos);
-                for (auto & e : ghosts) {
-                    diffRedraw.push_back(e->getTransform().position);
+                for (size_t j = 0; j < ghosts.size(); j++) {
+                    diffRedraw.push_back(ghosts.getPosition(j));
                 }
 
                 restart();
@@ -75,25 +85,135 @@ void Game::detectCollisions() {
     }
 }
 
+void Game::createEnemies() {
+    Transform enemySpawn(board->getEnemySpawn(), Rotation(Rotation::Direction::left));
+    ghosts.clear();
+    releaseOrder.clear();
+
+    if (settings.ghostRoster.empty()) {
+        // Create four original ghosts
+        ghosts.add(Enemies::Type::blinky, enemySpawn, Position(0, board->getSizeX()));
+        ghosts.add(Enemies::Type::pinky, enemySpawn, Position(0, 0));
+        ghosts.add(Enemies::Type::inky, enemySpawn, Position(board->getSizeY(), board->getSizeY()));
+        ghosts.add(Enemies::Type::clyde, enemySpawn, Position(board->getSizeY(), 0));
+
+        for (size_t i = 0; i < ghosts.size(); i++) {
+            releaseOrder.emplace_back(settings.ghostComeOutPeriod * i, i);
+        }
+    } else {
+        for (auto & group : settings.ghostRoster) {
+            // Negative coordinates of scatter target count from the end of board
+            Position scatterPos(
+                group.scatterX < 0 ? (int) board->getSizeX() + group.scatterX : group.scatterX,
+                group.scatterY < 0 ? (int) board->getSizeY() + group.scatterY : group.scatterY);
+
+            Enemies::Type type = *Enemies::typeFromName(group.type);
+            for (unsigned int c = 0; c < group.count; c++) {
+                releaseOrder.emplace_back(group.release, ghosts.add(type, enemySpawn, scatterPos));
+            }
+        }
+    }
+
+    // Stable sort keeps order of enemies with the same release time
+    std::stable_sort(releaseOrder.begin(), releaseOrder.end(), [ ](auto & lhs, auto & rhs) {
+        return lhs.first < rhs.first;
+        });
+    nextRelease = 0;
+
+    specialGhost = 0;
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (ghosts.getType(i) == Enemies::Type::blinky) {
+            specialGhost = i;
+            break;
+        }
+    }
+}
+
+void Game::releaseEnemies() {
+    unsigned int now = releaseOrder[nextRelease].first;
+    while (nextRelease < releaseOrder.size() && releaseOrder[nextRelease].first == now) {
+        ghosts.toggleAlive(releaseOrder[nextRelease].second);
+        nextRelease++;
+    }
+    entitiesMoved = true;
+
+    if (nextRelease < releaseOrder.size()) {
+        timer.addTrigger(releaseOrder[nextRelease].first - now, [ this ]() {
+            this->releaseEnemies();
+            }, false, "release enemies");
+    }
+}
+
 void Game::movePlayer() {
+    Profiler::Scope profile(Profiler::movePlayer);
+
     needsRedraw = true;
+    entitiesMoved = true;
     diffRedraw.push_back(player->getTransform().position); //< Add previous position
     // of player into diffRedraw
     player->move(*board);
 }
 
 void Game::moveEnemy(bool fright) {
+    Profiler::Scope profile(Profiler::moveEnemy);
+
     needsRedraw = true;
+    entitiesMoved = true;
+
+    // Enemies moving in this movement, if method fright mode matches enemy's fright mode
+    std::vector<bool> moving(ghosts.size());
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        moving[i] = (ghosts.isFrightened(i) == fright);
+    }
 
-    for (auto & e : ghosts) {
-        diffRedraw.push_back(e->getTransform().position); //< Add previous enemy position
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        diffRedraw.push_back(ghosts.getPosition(i)); //< Add previous enemy position
         // into diffRedraw
 
-        // If method fright mode matches enemy's fright mode move enemy
-        if ((e->isFrightened() && fright) || (!e->isFrightened() && !fright)) {
-            // Pass Blinky's position as special position for movement target calculation
-            e->move(*board, player->getTransform(), ghosts[0]->getTransform().position);
+        if (moving[i]) {
+            ghosts.advance(i, *board);
+        }
+    }
+
+    // Targets of chasing enemies were planned together in background since previous
+    // movement, for states they reached now
+    std::vector<std::optional<GhostPlanner::GhostState>> states;
+    if (planner && !fright) {
+        states.resize(ghosts.size());
+        for (size_t i = 0; i < ghosts.size(); i++) {
+            if (moving[i] && ghosts.isAlive(i) && !ghosts.isScattering(i)) {
+                states[i] = GhostPlanner::GhostState { ghosts.getPosition(i), ghosts.getCurrentDirection(i) };
+            }
+        }
+
+        std::vector<std::optional<Position>> targets = planner->collect(states);
+        for (size_t i = 0; i < ghosts.size(); i++) {
+            ghosts.setPlannedTarget(i, targets[i]);
+        }
+    }
+
+    // Targets changed after movement, fields from previous movement can't be used
+    if (flowFields) {
+        flowFields->clear();
+    }
+
+    // Pass Blinky's position as special position for movement target calculation
+    Transform playerTransform = player->getTransform();
+    Position blinkyPosition = ghosts.size() != 0 ? ghosts.getPosition(specialGhost) : Position();
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (moving[i]) {
+            ghosts.steer(i, *board, playerTransform, blinkyPosition, flowFields.get());
+        }
+    }
+
+    // After steering, states reached by next movement are known and planned until then
+    if (planner && !fright) {
+        for (size_t i = 0; i < ghosts.size(); i++) {
+            if (states[i]) {
+                states[i] = GhostPlanner::GhostState { ghosts.advancedPosition(i, *board), ghosts.getNextRotation(i) };
+            }
         }
+        planner->start(states, playerTransform);
     }
 
     // Add next fright move timer trigger if move is in fright mode and frightened mode 
@@ -102,7 +222,7 @@ void Game::moveEnemy(bool fright) {
         // Timer trigger can't be cerated as repeated, because it wouldn't be possible to turn off 
         timer.addTrigger(settings.enemySpeed * frightenSpeedMultiplier, [ this ]() {
             this->moveEnemy(true);
-            });
+            }, false, "move frightened enemy");
     }
 }
 
@@ -117,8 +237,8 @@ void Game::createBonus() {
 
 void Game::toggleScatter() {
     needsRedraw = true;
-    for (auto & e : ghosts) {
-        e->toggleScatter(*board);
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        ghosts.toggleScatter(i, *board);
     }
 }
 
@@ -133,7 +253,7 @@ void Game::toggleFrighten(bool on) {
 
         timer.addTrigger(settings.frightenDuration, [ this ]() {
             this->toggleFrighten(false);
-            });
+            }, false, "end frighten");
     } else {
         frightenActivated--;
         killStreak = 0;
@@ -143,14 +263,14 @@ void Game::toggleFrighten(bool on) {
     // If toggle is on and enemy is not in frightened mode, toggle frightened on enemy
     // If toggle is off and is last active frighten (no other frighten is activated),
     // toggle frightened off all enemies that are frightened
-    for (auto & e : ghosts) {
-        if (!e->isAlive()) {
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (!ghosts.isAlive(i)) {
             continue;
         }
 
-        if ((!e->isFrightened() && on)
-            || (e->isFrightened() && frightenActivated == 0)) {
-            e->toggleFrighten(*board);
+        if ((!ghosts.isFrightened(i) && on)
+            || (ghosts.isFrightened(i) && frightenActivated == 0)) {
+            ghosts.toggleFrighten(i, *board);
         }
     }
 
@@ -158,7 +278,7 @@ void Game::toggleFrighten(bool on) {
     if (on && frightenActivated == 1) {
         timer.addTrigger(settings.enemySpeed * frightenSpeedMultiplier, [ this ]() {
             this->moveEnemy(true);
-            });
+            }, false, "move frightened enemy");
     }
 }
 
@@ -166,18 +286,36 @@ Game::Game(
     const GameSettings & gameSettings,
     double frightenMultiplier,
     unsigned int livesAmount,
-    unsigned int enemyLevel)
+    unsigned int enemyLevel,
+    bool manualClock,
+    unsigned int plannerSeed)
     :
     settings(gameSettings),
     needsRedraw(false),
+    manualTime(manualClock),
+    timer(manualClock),
+    playerMoveTrigger(0),
+    enemyMoveTrigger(0),
+    bonusTrigger(0),
     board(nullptr),
     player(nullptr),
+    ghosts(enemyLevel),
+    specialGhost(0),
+    nextRelease(0),
+    entitiesMoved(false),
     enemyIntelligence(enemyLevel),
     score(0),
     lives(livesAmount),
     killStreak(0),
     frightenActivated(0),
-    frightenSpeedMultiplier(frightenMultiplier) { }
+    frightenSpeedMultiplier(frightenMultiplier) {
+    if (enemyIntelligence >= FLOWFIELDENEMYINTELLIGENCE) {
+        flowFields.reset(new FlowFields());
+    }
+    if (enemyIntelligence >= PLANNEDENEMYINTELLIGENCE) {
+        planner.reset(new GhostPlanner(settings.ghostSearchBudget, settings.enemySpeed, settings.playerSpeed, 0, plannerSeed));
+    }
+}
 
 void Game::loadBoard(const Board & map) {
     board.reset(new Board(map));
@@ -192,7 +330,17 @@ void Game::restart() {
         return;
     }
 
-    timer = Timer();
+    Timer restartedTimer(manualTime);
+    restartedTimer.mergeLateness(timer);
+    timer = restartedTimer;
+    scatterTriggers.clear();
+
+    if (flowFields) {
+        flowFields->prepare(board.get());
+    }
+    if (planner) {
+        planner->prepare(board.get());
+    }
 
     killStreak = 0;
     frightenActivated = 0;
@@ -201,46 +349,39 @@ void Game::restart() {
     Transform playerSpawn(board->getPlayerSpawn(), Rotation(Rotation::Direction::left));
     player.reset(new Player(playerSpawn));
 
-    // Create four new ghosts
-    Transform enemySpawn(board->getEnemySpawn(), Rotation(Rotation::Direction::left));
-    ghosts.resize(4);
-    ghosts[0].reset(
-        new GhostBlinky(enemySpawn, Position(0, board->getSizeX()), enemyIntelligence));
-    ghosts[1].reset(
-        new GhostPinky(enemySpawn, Position(0, 0), enemyIntelligence));
-    ghosts[2].reset(
-        new GhostInky(enemySpawn, Position(board->getSizeY(), board->getSizeY()), enemyIntelligence));
-    ghosts[3].reset(
-        new GhostClyde(enemySpawn, Position(board->getSizeY(), 0), enemyIntelligence));
-
-    // Create movement timer triggers
-    timer.addTrigger(settings.playerSpeed, [ this ]() {
+    // Create new ghosts
+    createEnemies();
+    entitiesMoved = true;
+
+    // Create movement timer triggers, moves missed by late update are all performed
+    playerMoveTrigger = timer.addTrigger(settings.playerSpeed, [ this ]() {
         this->movePlayer();
-        }, true);
-    timer.addTrigger(settings.enemySpeed, [ this ]() {
+        }, true, "move player", Timer::CatchUp::all);
+    enemyMoveTrigger = timer.addTrigger(settings.enemySpeed, [ this ]() {
         this->moveEnemy();
-        }, true);
+        }, true, "move enemy", Timer::CatchUp::all);
 
     // Create bonus creation timer triggers
-    timer.addTrigger(settings.bonusPeriod, [ this ]() {
+    bonusTrigger = timer.addTrigger(settings.bonusPeriod, [ this ]() {
         this->createBonus();
-        }, true);
+        }, true, "create bonus");
 
     // Create chase and scatter modes timer triggers
-    timer.addTrigger(settings.chaseDuration + settings.scatterDuration, [ this ]() {
+    // (all toggles are performed, so mode stays in phase with schedule)
+    scatterTriggers.push_back(timer.addTrigger(settings.chaseDuration + settings.scatterDuration, [ this ]() {
         this->toggleScatter();
-        }, true);
+        }, true, "toggle scatter", Timer::CatchUp::all));
     timer.addTrigger(settings.scatterDuration, [ this ]() {
-        this->timer.addTrigger(settings.chaseDuration + settings.scatterDuration, [ this ]() {
+        this->scatterTriggers.push_back(this->timer.addTrigger(settings.chaseDuration + settings.scatterDuration, [ this ]() {
             this->toggleScatter();
-            }, true);
-        }, false);
-
-    // Create triggers for ghosts to come out
-    for (size_t i = 0; i < ghosts.size(); i++) {
-        timer.addTrigger(settings.ghostComeOutPeriod * i, [ this, i ]() {
-            this->ghosts[i]->toggleAlive();
-            });
+            }, true, "toggle scatter", Timer::CatchUp::all));
+        }, false, "start scatter cycle");
+
+    // Create trigger for the first ghosts to come out, following are chained
+    if (!releaseOrder.empty()) {
+        timer.addTrigger(releaseOrder.front().first, [ this ]() {
+            this->releaseEnemies();
+            }, false, "release enemies");
     }
 
     needsRedraw = true;
@@ -259,18 +400,74 @@ void Game::update(std::optional<Rotation> keyPressDirection) {
         }
     }
 
+    // Settings change between ticks, so no action is performed with mixed settings
+    if (pendingSettings) {
+        applySettings();
+    }
+
     if (!isPaused()) {
-        timer.update();
+        // Triggers missed by late update are performed one planned time after another,
+        // with collisions detected after each, so entities can't pass through each other,
+        // catching up ends at time of beginning of update, slow movements can't keep it going
+        Timer::timepoint until = timer.now();
+        size_t due;
+        size_t steps = 0;
+        do {
+            {
+                Profiler::Scope profile(Profiler::timerUpdate);
+                due = timer.update(true, until);
+            }
 
-        detectCollisions();
+            if (due != 0 || steps == 0) {
+                detectCollisions();
+            }
+            steps++;
+        } while (due != 0 && !isPaused() && steps < GAMEMAXCATCHUPSTEPS);
+
+        if (due != 0 && !isPaused()) {
+            timer.skipMissed(); //< Game can't keep up, movements continue from now
+        }
     }
 }
 
-unsigned int Game::getDimensionX() {
+void Game::applySettings() {
+    settings = *pendingSettings;
+    pendingSettings.reset();
+
+    timer.setPeriod(playerMoveTrigger, settings.playerSpeed);
+    timer.setPeriod(enemyMoveTrigger, settings.enemySpeed);
+    timer.setPeriod(bonusTrigger, settings.bonusPeriod);
+    for (auto & trigger : scatterTriggers) {
+        timer.setPeriod(trigger, settings.chaseDuration + settings.scatterDuration);
+    }
+    if (planner) {
+        planner->configure(settings.ghostSearchBudget, settings.enemySpeed, settings.playerSpeed);
+    }
+
+    needsRedraw = true;
+}
+
+void Game::changeSettings(const GameSettings & newSettings) {
+    pendingSettings = newSettings;
+}
+
+const GameSettings & Game::getSettings() const {
+    return settings;
+}
+
+const std::vector<Timer::Lateness> & Game::getTriggerLateness() {
+    return timer.getLateness();
+}
+
+void Game::advanceTime(unsigned int milliseconds) {
+    timer.advance(milliseconds);
+}
+
+size_t Game::getDimensionX() {
     return board->getSizeX();
 }
 
-unsigned int Game::getDimensionY() {
+size_t Game::getDimensionY() {
     return board->getSizeY();
 }
 
@@ -283,6 +480,10 @@ bool Game::isPaused() {
     return timer.isPaused();
 }
 
+std::optional<unsigned int> Game::getTimeToNextUpdate() {
+    return timer.timeToNextTrigger();
+}
+
 unsigned long Game::getScore() {
     return score;
 }
@@ -295,6 +496,20 @@ unsigned int Game::getCoinsRemaining() {
     return board->getNumberOfCoins();
 }
 
+std::optional<double> Game::getPlanningTime() {
+    if (!planner) {
+        return { };
+    }
+    return planner->getLastPlanTime();
+}
+
+std::optional<double> Game::getMaxPlanningTime() {
+    if (!planner) {
+        return { };
+    }
+    return planner->getMaxPlanTime();
+}
+
 bool Game::doesNeedRefresh() {
     return needsRedraw;
 }
\ No newline at end of file
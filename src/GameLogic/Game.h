@@ -12,6 +12,10 @@
 #ifndef GAME_H
 #define GAME_H
 
+#define FLOWFIELDENEMYINTELLIGENCE 3 //< Intelligence level from which ghosts follow maze distance
+#define PLANNEDENEMYINTELLIGENCE 3 //< Intelligence level from which ghosts plan together
+#define GAMEMAXCATCHUPSTEPS 32 //< Planned times performed by one update, further missed movements are skipped
+
 #include <vector>
 #include <memory>
 #include <string>
@@ -19,7 +23,9 @@
 
 #include "Utilities/Timer.h"
 #include "GameLogic/Entities/Player.h"
-#include "GameLogic/Entities/Ghosts/Ghosts.h"
+#include "GameLogic/Entities/Enemies.h"
+#include "GameLogic/AI/GhostPlanner.h"
+#include "GameLogic/AI/FlowFields.h"
 #include "Utilities/Contexts/GameSettings.h"
 
 /**
@@ -33,23 +39,46 @@ class Game {
     // effective displaying
     friend class GameView;
     friend class GameDetailView;
+    friend class GameObservation;
+    // Autopilot as friend class so it can effectively search the board
+    friend class Autopilot;
 
 private:
     GameSettings settings; //< Settings object containing configuration
+    std::optional<GameSettings> pendingSettings; //< Settings to apply at next update
 
     bool needsRedraw; //< Indicator if values that can be displayed have changed
     std::vector<Position> diffRedraw; //< Positions in board that have changed and
     // probably should be redrawn
 
+    const bool manualTime; //< Game time moves only when advanced
     Timer timer; //< Timer used for timing action
+    Timer::TriggerId playerMoveTrigger; //< Repeating trigger of player movement
+    Timer::TriggerId enemyMoveTrigger; //< Repeating trigger of enemy movement
+    Timer::TriggerId bonusTrigger; //< Repeating trigger of bonus creation
+    std::vector<Timer::TriggerId> scatterTriggers; //< Repeating triggers of scatter toggling
 
     std::unique_ptr<Board> board; //< Game board
 
     std::unique_ptr<Player> player; //< Player entity
-    std::vector<std::unique_ptr<Enemy>> ghosts; //< Enemy entities
+    Enemies ghosts; //< Enemy entities
+    size_t specialGhost; //< Enemy whose position is special position for targets
+    // of others (the first Blinky)
+
+    std::vector<std::pair<unsigned int, size_t>> releaseOrder; //< Release times of enemies
+    // after restart in milliseconds, sorted
+    size_t nextRelease; //< Index of next release in releaseOrder
+
+    bool entitiesMoved; //< Indicator if some entity moved or appeared since last
+    // detection of collisions
 
     const unsigned int enemyIntelligence; //< Setting of game, intelligence of enemies
 
+    std::unique_ptr<FlowFields> flowFields; //< Flow fields shared by enemies in one
+    // movement, only with flow field intelligence
+    std::unique_ptr<GhostPlanner> planner; //< Planner of chasing enemies, only with
+    // planned intelligence
+
     unsigned long score; //< Current reached score
     unsigned int lives; //< Lives remaining
 
@@ -63,6 +92,34 @@ private:
      */
     void detectCollisions();
 
+    /**
+     * @brief Create enemies from roster in settings
+     *
+     * If roster is empty, the four original ghosts are created.
+     *
+     */
+    void createEnemies();
+
+    /**
+     * @brief Apply pending settings
+     *
+     * Periods of running repeating triggers and budget and periods of planner
+     * are changed to new values, other durations are used when their triggers
+     * are created next time. Ghost roster and release times are used from next
+     * restart.
+     *
+     */
+    void applySettings();
+
+    /**
+     * @brief Release enemies whose release time has come
+     *
+     * Creates timer trigger for next release, so only one release trigger exists
+     * regardless of amount of enemies.
+     *
+     */
+    void releaseEnemies();
+
     /**
      * @brief Move player entity
      *
@@ -77,6 +134,12 @@ private:
      *
      * Enemy moves only if frightened movement matches frighten status of enemy
      *
+     * If enemies have planned intelligence, after normal mode move, targets of
+     * chasing enemies are planned together before enemies calculate next direction.
+     *
+     * If enemies have flow field intelligence, at most one flow field is computed
+     * for each target in the movement and it is shared by enemies with the target.
+     *
      * If frightened movement, creates timer trigger for next frightened movement
      *
      * @param fright Frightened movement
@@ -125,12 +188,16 @@ public:
      * @param frightenMultiplier Enemy speed multiplier in frightened mode setting
      * @param livesAmount Initial lives amount
      * @param enemyLevel Intelligence level of enemies setting
+     * @param manualClock Game time moves only using advanceTime, instead of real time
+     * @param plannerSeed Seed of planning of ghosts with highest intelligence
      */
     Game(
         const GameSettings & gameSettings,
         double frightenMultiplier,
         unsigned int livesAmount,
-        unsigned int enemyLevel = 1);
+        unsigned int enemyLevel = 1,
+        bool manualClock = false,
+        unsigned int plannerSeed = GHOSTPLANNERDEFAULTSEED);
 
     /**
      * @brief Load board which should be used to play in
@@ -154,7 +221,11 @@ public:
      *
      * Should be called periodically in loop.
      *
-     * Performs all game actions for which the time has come.
+     * Performs all game actions for which the time has come. After stall, missed
+     * movements are performed in order of their planned times, collisions are
+     * detected after each. Only movements planned before the update began are
+     * caught up, at most GAMEMAXCATCHUPSTEPS planned times, the rest is skipped,
+     * so update ends even if movements take longer than their periods.
      *
      * Sets player's next movement direction from parameter.
      *
@@ -162,19 +233,52 @@ public:
      */
     void update(std::optional<Rotation> keyPressDirection);
 
+    /**
+     * @brief Change settings of running game
+     *
+     * Settings are applied at the beginning of next update, before any action
+     * is performed (see applySettings).
+     *
+     * @param newSettings new game settings
+     */
+    void changeSettings(const GameSettings & newSettings);
+
+    /**
+     * @brief Get current settings
+     *
+     * @return const GameSettings&
+     */
+    const GameSettings & getSettings() const;
+
+    /**
+     * @brief Get lateness of timer triggers since construction of game
+     *
+     * @return const std::vector<Timer::Lateness>&
+     */
+    const std::vector<Timer::Lateness> & getTriggerLateness();
+
+    /**
+     * @brief Move game time forward
+     *
+     * Game needs to be constructed with manual clock. Actions are performed on next update.
+     *
+     * @param milliseconds milliseconds to move game time by
+     */
+    void advanceTime(unsigned int milliseconds);
+
     /**
      * @brief Size of x dimension of game board
      *
-     * @return unsigned int
+     * @return size_t
      */
-    unsigned int getDimensionX();
+    size_t getDimensionX();
 
     /**
      * @brief Size of y dimension of game board
      *
-     * @return unsigned int
+     * @return size_t
      */
-    unsigned int getDimensionY();
+    size_t getDimensionY();
 
     /**
      * @brief Pause/unpause game
@@ -190,6 +294,13 @@ public:
      */
     bool isPaused();
 
+    /**
+     * @brief Get time until game changes by itself (next timer trigger)
+     *
+     * @return std::optional<unsigned int> milliseconds, empty if game is paused
+     */
+    std::optional<unsigned int> getTimeToNextUpdate();
+
     /**
      * @brief Get current score
      *
@@ -211,6 +322,20 @@ public:
      */
     unsigned int getCoinsRemaining();
 
+    /**
+     * @brief Get duration of last planning of enemies
+     *
+     * @return std::optional<double> milliseconds, empty if enemies don't plan
+     */
+    std::optional<double> getPlanningTime();
+
+    /**
+     * @brief Get maximal duration of planning of enemies
+     *
+     * @return std::optional<double> milliseconds, empty if enemies don't plan
+     */
+    std::optional<double> getMaxPlanningTime();
+
     /**
      * @brief Have values that can be displayed changed
      *
@@ -0,0 +1,193 @@
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "GameLogic/GameObservation.h"
+
+size_t GameObservation::bitIndex(const Position & pos) const {
+    return (pos.y * wordsPerRow * 64) + pos.x;
+}
+
+void GameObservation::setBit(size_t plane, size_t bit, bool value) {
+    uint64_t & word = planes[(plane * wordsPerPlane) + (bit / 64)];
+    uint64_t mask = (uint64_t(1) << (bit % 64));
+    if (value) {
+        word |= mask;
+    } else {
+        word &= ~mask;
+    }
+}
+
+void GameObservation::encode() {
+    observedBoard = gameToObserve->board.get();
+    sizeX = observedBoard->getSizeX();
+    sizeY = observedBoard->getSizeY();
+    wordsPerRow = (sizeX + 63) / 64;
+    wordsPerPlane = wordsPerRow * sizeY;
+    planeCount = Plane::firstGhost + gameToObserve->ghosts.size();
+
+    planes.assign(planeCount * wordsPerPlane, 0);
+    entityBits.clear();
+
+    for (size_t y = 0; y < sizeY; y++) {
+        encodeRow(y);
+    }
+
+    updateEntities();
+}
+
+void GameObservation::encodeRow(size_t y) {
+    // Tile types are single bytes, so whole blocks of row can be compared against
+    // each type at once, and the comparison masks are bits of the planes
+    const unsigned char * row = reinterpret_cast<const unsigned char *>(
+        observedBoard->tileRow(y, 0, sizeX, rowBuffer));
+
+    uint64_t * words[4];
+    const Board::Tile::Type types[4] = {
+        Board::Tile::Type::wall,
+        Board::Tile::Type::coin,
+        Board::Tile::Type::frighten,
+        Board::Tile::Type::bonus
+    };
+    for (size_t p = 0; p < 4; p++) {
+        words[p] = &planes[(p * wordsPerPlane) + (y * wordsPerRow)];
+    }
+
+    size_t x = 0;
+
+    // Blocks start at multiples of block size, so block never crosses word boundary
+#if defined(__AVX2__)
+    for (; x + 32 <= sizeX; x += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + x));
+        for (size_t p = 0; p < 4; p++) {
+            __m256i type = _mm256_set1_epi8(static_cast<char>(types[p]));
+            uint64_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, type)));
+            words[p][x / 64] |= (mask << (x % 64));
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    for (; x + 16 <= sizeX; x += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + x));
+        for (size_t p = 0; p < 4; p++) {
+            __m128i type = _mm_set1_epi8(static_cast<char>(types[p]));
+            uint64_t mask = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, type)));
+            words[p][x / 64] |= (mask << (x % 64));
+        }
+    }
+#endif
+
+    // Remaining tiles (or whole row without SIMD support)
+    for (; x < sizeX; x++) {
+        for (size_t p = 0; p < 4; p++) {
+            if (row[x] == static_cast<unsigned char>(types[p])) {
+                words[p][x / 64] |= (uint64_t(1) << (x % 64));
+            }
+        }
+    }
+}
+
+void GameObservation::updateTile(const Position & pos) {
+    if (!observedBoard->isTileCoordinateValid(pos)) {
+        return;
+    }
+
+    // Walls are static, only interactable tiles can change
+    Board::Tile::Type type = observedBoard->tileAt(pos);
+    size_t bit = bitIndex(pos);
+    setBit(Plane::coins, bit, type == Board::Tile::Type::coin);
+    setBit(Plane::frighten, bit, type == Board::Tile::Type::frighten);
+    setBit(Plane::bonus, bit, type == Board::Tile::Type::bonus);
+}
+
+void GameObservation::updateEntities() {
+    for (auto & e : entityBits) {
+        setBit(e.first, e.second, false);
+    }
+    entityBits.clear();
+
+    if (gameToObserve->player) {
+        entityBits.emplace_back(Plane::player, bitIndex(gameToObserve->player->getTransform().position));
+    }
+
+    const Enemies & ghosts = gameToObserve->ghosts;
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (!ghosts.isAlive(i)) {
+            continue;
+        }
+
+        size_t bit = bitIndex(ghosts.getPosition(i));
+        entityBits.emplace_back(Plane::firstGhost + i, bit);
+        if (ghosts.isFrightened(i)) {
+            entityBits.emplace_back(Plane::frightenedGhosts, bit);
+        }
+    }
+
+    for (auto & e : entityBits) {
+        setBit(e.first, e.second, true);
+    }
+}
+
+GameObservation::GameObservation(const Game * game)
+    :
+    gameToObserve(game),
+    observedBoard(nullptr),
+    sizeX(0),
+    sizeY(0),
+    wordsPerRow(0),
+    wordsPerPlane(0),
+    planeCount(0) {
+    if (gameToObserve == nullptr || !gameToObserve->board) {
+        throw std::invalid_argument("GameObservation: GameObservation - game without board");
+    }
+
+    encode();
+}
+
+void GameObservation::update() {
+    // Board was reloaded or ghosts were recreated, planes need to be encoded again
+    if (gameToObserve->board.get() != observedBoard
+        || Plane::firstGhost + gameToObserve->ghosts.size() != planeCount) {
+        encode();
+        return;
+    }
+
+    for (auto & pos : gameToObserve->diffRedraw) {
+        updateTile(pos);
+    }
+
+    updateEntities();
+}
+
+const uint64_t * GameObservation::getPlane(size_t plane) const {
+    if (plane >= planeCount) {
+        throw std::out_of_range("GameObservation: getPlane - plane doesn't exist");
+    }
+    return planes.data() + (plane * wordsPerPlane);
+}
+
+bool GameObservation::test(size_t plane, const Position & pos) const {
+    if (plane >= planeCount || !observedBoard->isTileCoordinateValid(pos)) {
+        return false;
+    }
+
+    size_t bit = bitIndex(pos);
+    return (getPlane(plane)[bit / 64] >> (bit % 64)) & 1;
+}
+
+size_t GameObservation::getPlaneCount() const {
+    return planeCount;
+}
+
+size_t GameObservation::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+size_t GameObservation::getWordsPerPlane() const {
+    return wordsPerPlane;
+}
@@ -0,0 +1,176 @@
+/****************************************************************
+ * @file GameObservation.h
+ * @author Michal Dobes
+ * @brief Bit-plane observation of game
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef GAMEOBSERVATION_H
+#define GAMEOBSERVATION_H
+
+#include <cstdint>
+#include <vector>
+
+#include "GameLogic/Game.h"
+#include "GameLogic/Board.h"
+
+/**
+ * @brief Bit-plane observation of game
+ *
+ * Encodes board and entities of game as planes of bits, one bit for each tile
+ * of board, packed into 64 bit words. Each row of plane starts at the beggining
+ * of a word (rows are padded), so bit for tile at x, y is bit (x % 64) of word
+ * (y * getWordsPerRow() + x / 64).
+ *
+ * Wall plane is encoded only once for each loaded board. Other tile planes are
+ * updated only at tiles that have changed since last update, entity planes
+ * are updated only at previous and current positions of entities.
+ *
+ * @warning update() should be called after each Game::update, changed tiles
+ * are taken from game and are valid only until the next game update.
+ *
+ */
+class GameObservation {
+public:
+    /**
+     * @brief Planes of observation
+     *
+     * Planes of ghosts follow after firstGhost, one plane for each ghost.
+     *
+     */
+    enum Plane : size_t {
+        walls = 0,
+        coins,
+        frighten,
+        bonus,
+        player,
+        frightenedGhosts,
+        firstGhost
+    };
+
+private:
+    const Game * gameToObserve; //< Pointer to observed game
+    const Board * observedBoard; //< Board for which planes were encoded
+
+    size_t sizeX; //< Size of observed board in x dimension
+    size_t sizeY; //< Size of observed board in y dimension
+    size_t wordsPerRow; //< Words in each row of plane
+    size_t wordsPerPlane; //< Words in each plane
+    size_t planeCount; //< Number of planes
+
+    std::vector<uint64_t> planes; //< Planes stored lineary in succession
+    std::vector<std::pair<size_t, size_t>> entityBits; //< Planes and bit indexes of entities
+    std::vector<Board::Tile::Type> rowBuffer; //< Buffer for rows of board stored in chunks
+    // set during last update
+
+    /**
+     * @brief Get bit index of position in plane
+     *
+     * @param pos position in board
+     * @return size_t bit index
+     */
+    size_t bitIndex(const Position & pos) const;
+
+    /**
+     * @brief Set or clear bit in plane
+     *
+     * @param plane plane
+     * @param bit bit index
+     * @param value set if true, else clear
+     */
+    void setBit(size_t plane, size_t bit, bool value);
+
+    /**
+     * @brief Encode all planes from scratch
+     *
+     * Tile planes are encoded from whole rows of board at once.
+     *
+     */
+    void encode();
+
+    /**
+     * @brief Encode tile planes of one row of board
+     *
+     * @param y row of board
+     */
+    void encodeRow(size_t y);
+
+    /**
+     * @brief Update tile planes at position
+     *
+     * @param pos position of tile in board
+     */
+    void updateTile(const Position & pos);
+
+    /**
+     * @brief Clear entity bits from last update and set them for current positions
+     *
+     */
+    void updateEntities();
+
+public:
+    /**
+     * @brief Construct a new Game Observation object
+     *
+     * Note, observation should not own the game object.
+     * Game object should be owned by other object and needs to have loaded board.
+     *
+     * @param game pointer to game to observe
+     */
+    GameObservation(const Game * game);
+
+    /**
+     * @brief Update planes from changes of observed game
+     *
+     * If board of game was reloaded or number of ghosts changed, encodes all planes
+     * again.
+     *
+     */
+    void update();
+
+    /**
+     * @brief Get plane
+     *
+     * @exception std::out_of_range plane doesn't exist
+     *
+     * @param plane index of plane (Plane value, or firstGhost + index of ghost)
+     * @return const uint64_t* first word of plane
+     */
+    const uint64_t * getPlane(size_t plane) const;
+
+    /**
+     * @brief Check if bit for position is set in plane
+     *
+     * @param plane index of plane
+     * @param pos position in board
+     * @return true
+     * @return false
+     */
+    bool test(size_t plane, const Position & pos) const;
+
+    /**
+     * @brief Get number of planes
+     *
+     * @return size_t
+     */
+    size_t getPlaneCount() const;
+
+    /**
+     * @brief Get number of words in row of plane
+     *
+     * @return size_t
+     */
+    size_t getWordsPerRow() const;
+
+    /**
+     * @brief Get number of words in plane
+     *
+     * @return size_t
+     */
+    size_t getWordsPerPlane() const;
+};
+
+#endif /* GAMEOBSERVATION_H */
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <queue>
+
+#include "GameLogic/MapAnalysis.h"
+#include "GameLogic/AI/JunctionGraph.h"
+
+MapAnalysis::MapAnalysis(const Board & board)
+    :
+    coins(0),
+    reachableCoins(0),
+    frightens(0),
+    reachableFrightens(0),
+    enemySpawnReachable(false),
+    deadEnds(0),
+    crossroads(0),
+    corridors(0),
+    minCorridorLength(0),
+    maxCorridorLength(0),
+    averageCorridorLength(0) {
+
+    size_t sizeX = board.getSizeX();
+    size_t sizeY = board.getSizeY();
+
+    // Flood fill from player spawn
+    std::vector<bool> reached(sizeX * sizeY, false);
+    std::queue<Position> open;
+
+    Position playerSpawn = board.getPlayerSpawn();
+    reached[(playerSpawn.y * sizeX) + playerSpawn.x] = true;
+    open.push(playerSpawn);
+
+    while (!open.empty()) {
+        Position current = open.front();
+        open.pop();
+
+        for (size_t d = 0; d < 4; d++) {
+            Position next = board.neighbourPosition(current, Rotation(d));
+            if (!board.isTileAllowingMovement(next)) {
+                continue;
+            }
+
+            size_t index = (next.y * sizeX) + next.x;
+            if (!reached[index]) {
+                reached[index] = true;
+                open.push(next);
+            }
+        }
+    }
+
+    Position enemySpawn = board.getEnemySpawn();
+    enemySpawnReachable = reached[(enemySpawn.y * sizeX) + enemySpawn.x];
+
+    // Count tiles by rows
+    std::vector<Board::Tile::Type> buffer;
+    for (size_t y = 0; y < sizeY; y++) {
+        const Board::Tile::Type * row = board.tileRow(y, 0, sizeX, buffer);
+        for (size_t x = 0; x < sizeX; x++) {
+            bool isReached = reached[(y * sizeX) + x];
+            switch (row[x]) {
+                case Board::Tile::Type::coin:
+                    coins++;
+                    reachableCoins += isReached ? 1 : 0;
+                    break;
+                case Board::Tile::Type::frighten:
+                    frightens++;
+                    reachableFrightens += isReached ? 1 : 0;
+                    break;
+                default:
+                    break;
+            }
+
+            if (!Board::Tile::typeAllowsMovement(row[x])) {
+                continue;
+            }
+
+            Position pos(x, y);
+            if (board.isTileCrossroad(pos)) {
+                crossroads++;
+                continue;
+            }
+
+            size_t paths = 0;
+            for (size_t d = 0; d < 4; d++) {
+                if (board.isTileAllowingMovement(pos.movedBy(1, Rotation(d)))) {
+                    paths++;
+                }
+            }
+            if (paths <= 1 && !board.isTileEdge(pos)) {
+                deadEnds++;
+            }
+        }
+    }
+
+    // Corridors are edges of junction graph, each corridor is walkable in both directions
+    JunctionGraph graph(&board);
+    size_t totalLength = 0;
+    if (!graph.getEdges().empty()) {
+        minCorridorLength = graph.getEdges().front().tiles.size();
+    }
+    for (auto & edge : graph.getEdges()) {
+        size_t length = edge.tiles.size();
+        minCorridorLength = std::min(minCorridorLength, length);
+        maxCorridorLength = std::max(maxCorridorLength, length);
+        totalLength += length;
+    }
+    if (!graph.getEdges().empty()) {
+        corridors = graph.getEdges().size() / 2;
+        averageCorridorLength = (double) totalLength / graph.getEdges().size();
+    }
+}
+
+bool MapAnalysis::isPlayable() const {
+    return reachableCoins == coins;
+}
@@ -0,0 +1,60 @@
+/****************************************************************
+ * @file MapAnalysis.h
+ * @author Michal Dobes
+ * @brief Analysis of board structure
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPANALYSIS_H
+#define MAPANALYSIS_H
+
+#include <vector>
+
+#include "GameLogic/Board.h"
+
+/**
+ * @brief Analysis of board structure
+ *
+ * Finds out which tiles can be reached from player spawn (moving the same way
+ * as entities, including teleports at edges of board) and describes junctions
+ * and corridors of board (see JunctionGraph).
+ *
+ * Game ends with win only after all coins are eaten, so it can be won only if all
+ * coins are reachable.
+ *
+ */
+struct MapAnalysis {
+    size_t coins; //< Coin tiles in board
+    size_t reachableCoins; //< Coin tiles reachable from player spawn
+    size_t frightens; //< Frighten tiles (pellets) in board
+    size_t reachableFrightens; //< Frighten tiles reachable from player spawn
+    bool enemySpawnReachable; //< Enemy spawn is reachable from player spawn
+
+    size_t deadEnds; //< Tiles allowing movement with at most one path, which are not at edge
+    size_t crossroads; //< Tiles allowing movement with at least three paths
+
+    size_t corridors; //< Corridors between junctions
+    size_t minCorridorLength; //< Length of shortest corridor in tiles
+    size_t maxCorridorLength; //< Length of longest corridor in tiles
+    double averageCorridorLength; //< Average length of corridor in tiles
+
+    /**
+     * @brief Analyze board
+     *
+     * @param board board to analyze
+     */
+    MapAnalysis(const Board & board);
+
+    /**
+     * @brief Check if game in board can be won
+     *
+     * @return true all coins are reachable
+     * @return false
+     */
+    bool isPlayable() const;
+};
+
+#endif /* MAPANALYSIS_H */
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <vector>
+
+#include "GameLogic/MazeGenerator.h"
+
+void MazeGenerator::carveMaze(TileMatrix & tiles, size_t columns) {
+    size_t rows = (sizeY - 1) / 2;
+
+    std::vector<bool> visited(columns * rows, false);
+    std::vector<size_t> stack;
+
+    // Randomized depth first search with explicit stack, cell (i, j) is tile (2i + 1, 2j + 1)
+    size_t start = (random() % rows) * columns + (random() % columns);
+    visited[start] = true;
+    stack.push_back(start);
+    tiles.at(((start % columns) * 2) + 1, ((start / columns) * 2) + 1) = Board::Tile::Type::space;
+
+    while (!stack.empty()) {
+        size_t cell = stack.back();
+        size_t i = cell % columns;
+        size_t j = cell / columns;
+
+        size_t neighbours[4];
+        size_t count = 0;
+        if (j > 0 && !visited[cell - columns]) {
+            neighbours[count++] = cell - columns;
+        }
+        if (i + 1 < columns && !visited[cell + 1]) {
+            neighbours[count++] = cell + 1;
+        }
+        if (j + 1 < rows && !visited[cell + columns]) {
+            neighbours[count++] = cell + columns;
+        }
+        if (i > 0 && !visited[cell - 1]) {
+            neighbours[count++] = cell - 1;
+        }
+
+        if (count == 0) {
+            stack.pop_back();
+            continue;
+        }
+
+        size_t next = neighbours[random() % count];
+        size_t nextI = next % columns;
+        size_t nextJ = next / columns;
+
+        // Open wall between cells and next cell
+        tiles.at(i + nextI + 1, j + nextJ + 1) = Board::Tile::Type::space;
+        tiles.at((nextI * 2) + 1, (nextJ * 2) + 1) = Board::Tile::Type::space;
+
+        visited[next] = true;
+        stack.push_back(next);
+    }
+}
+
+void MazeGenerator::createLoops(TileMatrix & tiles, size_t columns) {
+    size_t rows = (sizeY - 1) / 2;
+
+    for (size_t j = 0; j < rows; j++) {
+        for (size_t i = 0; i < columns; i++) {
+            if (i + 1 < columns && chance(1 - density)) {
+                tiles.at((i * 2) + 2, (j * 2) + 1) = Board::Tile::Type::space;
+            }
+            if (j + 1 < rows && chance(1 - density)) {
+                tiles.at((i * 2) + 1, (j * 2) + 2) = Board::Tile::Type::space;
+            }
+        }
+    }
+}
+
+bool MazeGenerator::chance(double probability) {
+    return std::uniform_real_distribution<double>(0, 1)(random) < probability;
+}
+
+MazeGenerator::MazeGenerator(
+    size_t dimensionX,
+    size_t dimensionY,
+    double wallDensity,
+    Symmetry boardSymmetry,
+    unsigned long seed)
+    :
+    sizeX(dimensionX - ((dimensionX % 2 == 0) ? 1 : 0)),
+    sizeY(dimensionY - ((dimensionY % 2 == 0) ? 1 : 0)),
+    density(std::clamp(wallDensity, 0.0, 1.0)),
+    symmetry(boardSymmetry),
+    random(seed) {
+
+    if (dimensionX < 5 || dimensionY < 5) {
+        throw std::invalid_argument("MazeGenerator: MazeGenerator - too small");
+    }
+}
+
+Board MazeGenerator::generate() {
+    TileMatrix tiles(sizeX, sizeY);
+    for (size_t y = 0; y < sizeY; y++) {
+        for (size_t x = 0; x < sizeX; x++) {
+            tiles.at(x, y) = Board::Tile::Type::wall;
+        }
+    }
+
+    size_t cellsX = (sizeX - 1) / 2;
+    size_t cellsY = (sizeY - 1) / 2;
+
+    // With mirror symmetry only left half (with middle column of cells) is generated
+    size_t columns = (symmetry == Symmetry::mirror) ? (cellsX + 1) / 2 : cellsX;
+    carveMaze(tiles, columns);
+    createLoops(tiles, columns);
+
+    // Vertical teleports, top and bottom tile of column of cells
+    for (size_t i = 0; i < columns; i++) {
+        if (chance(0.125)) {
+            tiles.at((i * 2) + 1, 0) = Board::Tile::Type::space;
+            tiles.at((i * 2) + 1, sizeY - 1) = Board::Tile::Type::space;
+        }
+    }
+
+    if (symmetry == Symmetry::mirror) {
+        for (size_t y = 0; y < sizeY; y++) {
+            for (size_t x = (sizeX / 2) + 1; x < sizeX; x++) {
+                tiles.at(x, y) = tiles.at(sizeX - 1 - x, y);
+            }
+        }
+
+        // Even number of columns of cells leaves column of walls in the middle,
+        // halves are connected through it
+        if (cellsX % 2 == 0) {
+            tiles.at(sizeX / 2, ((random() % cellsY) * 2) + 1) = Board::Tile::Type::space;
+            for (size_t j = 0; j < cellsY; j++) {
+                if (chance(1 - density)) {
+                    tiles.at(sizeX / 2, (j * 2) + 1) = Board::Tile::Type::space;
+                }
+            }
+        }
+    }
+
+    // Horizontal teleports, left and right tile of row of cells
+    for (size_t j = 0; j < cellsY; j++) {
+        if (chance(0.125)) {
+            tiles.at(0, (j * 2) + 1) = Board::Tile::Type::space;
+            tiles.at(sizeX - 1, (j * 2) + 1) = Board::Tile::Type::space;
+        }
+    }
+
+    // Fill with coins, frighten tiles are in corner cells
+    for (size_t y = 0; y < sizeY; y++) {
+        for (size_t x = 0; x < sizeX; x++) {
+            if (tiles.at(x, y) == Board::Tile::Type::space) {
+                tiles.at(x, y) = Board::Tile::Type::coin;
+            }
+        }
+    }
+    tiles.at(1, 1) = Board::Tile::Type::frighten;
+    tiles.at(sizeX - 2, 1) = Board::Tile::Type::frighten;
+    tiles.at(1, sizeY - 2) = Board::Tile::Type::frighten;
+    tiles.at(sizeX - 2, sizeY - 2) = Board::Tile::Type::frighten;
+
+    // Spawns are in middle column of cells, enemy in the middle, player at the bottom
+    size_t middle = ((cellsX / 2) * 2) + 1;
+    Position enemySpawn(middle, (((cellsY - 1) / 2) * 2) + 1);
+    Position playerSpawn(middle, ((cellsY - 1) * 2) + 1);
+    tiles.at(enemySpawn.x, enemySpawn.y) = Board::Tile::defaultType();
+    tiles.at(playerSpawn.x, playerSpawn.y) = Board::Tile::defaultType();
+
+    // Enemies leave spawn to the left, so two tiles to the left need to allow movement
+    tiles.at(enemySpawn.x - 1, enemySpawn.y) = Board::Tile::Type::coin;
+    if (symmetry == Symmetry::mirror) {
+        tiles.at(sizeX - enemySpawn.x, enemySpawn.y) = Board::Tile::Type::coin;
+    }
+
+    return Board(tiles, enemySpawn, playerSpawn);
+}
+
+std::optional<MazeGenerator::Symmetry> MazeGenerator::symmetryFromName(const std::string & name) {
+    if (name == "none") {
+        return Symmetry::none;
+    }
+    if (name == "mirror") {
+        return Symmetry::mirror;
+    }
+    return { };
+}
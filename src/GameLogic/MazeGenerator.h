@@ -0,0 +1,119 @@
+/****************************************************************
+ * @file MazeGenerator.h
+ * @author Michal Dobes
+ * @brief Procedural generator of boards
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAZEGENERATOR_H
+#define MAZEGENERATOR_H
+
+#include <optional>
+#include <random>
+#include <string>
+
+#include "GameLogic/Board.h"
+#include "Structures/Matrix.h"
+
+/**
+ * @brief Procedural generator of boards
+ *
+ * Generates maze on grid of cells (tiles with odd coordinates), cells are connected
+ * by randomized depth first search, so every cell is reachable, and then walls
+ * between cells are removed to create loops. Teleports are added in pairs on opposite
+ * edges of board. All tiles allowing movement are coins, except spawns and four
+ * frighten tiles near corners. Enemy spawn has two tiles to the left that allow
+ * movement.
+ *
+ * Generated boards pass all checks of BoardFileLoader and all coins are reachable
+ * from player spawn.
+ *
+ */
+class MazeGenerator {
+public:
+    /**
+     * @brief Symmetry of generated board
+     *
+     */
+    enum class Symmetry {
+        none,
+        mirror //< Right half mirrors left half
+    };
+
+private:
+    typedef Matrix<Board::Tile::Type> TileMatrix;
+
+    size_t sizeX; //< Size in x dimension, odd
+    size_t sizeY; //< Size in y dimension, odd
+    double density; //< Probability that wall between cells is kept
+    Symmetry symmetry; //< Symmetry of board
+
+    std::mt19937_64 random; //< Random generator
+
+    /**
+     * @brief Connect cells in columns before columns by spanning tree
+     *
+     * @param tiles tiles of board
+     * @param columns number of columns of cells
+     */
+    void carveMaze(TileMatrix & tiles, size_t columns);
+
+    /**
+     * @brief Remove walls between cells in columns before columns with probability
+     *
+     * @param tiles tiles of board
+     * @param columns number of columns of cells
+     */
+    void createLoops(TileMatrix & tiles, size_t columns);
+
+    /**
+     * @brief Check if random event with probability happens
+     *
+     * @param probability probability of event
+     * @return true
+     * @return false
+     */
+    bool chance(double probability);
+
+public:
+    /**
+     * @brief Construct a new Maze Generator object
+     *
+     * Even sizes are decreased by one.
+     *
+     * @exception std::invalid_argument size smaller than 5 tiles
+     *
+     * @param dimensionX size of board in x dimension
+     * @param dimensionY size of board in y dimension
+     * @param wallDensity probability (0 to 1) that wall between cells is kept, with 1
+     *      maze has no loops
+     * @param boardSymmetry symmetry of board
+     * @param seed seed of random generator
+     */
+    MazeGenerator(
+        size_t dimensionX,
+        size_t dimensionY,
+        double wallDensity,
+        Symmetry boardSymmetry,
+        unsigned long seed);
+
+    /**
+     * @brief Generate board
+     *
+     * @return Board
+     */
+    Board generate();
+
+    /**
+     * @brief Get symmetry from its name
+     *
+     * @param name name of symmetry ("none" or "mirror")
+     * @return std::optional<Symmetry> empty if name is unknown
+     */
+    static std::optional<Symmetry> symmetryFromName(const std::string & name);
+};
+
+#endif /* MAZEGENERATOR_H */
@@ -0,0 +1,100 @@
+#include <chrono>
+
+#include "HeadlessRunner.h"
+#include "GameLogic/Game.h"
+#include "Utilities/Contexts/Autopilot.h"
+#include "Utilities/FileManagers/GameSettingsRecordsFileLoader.h"
+#include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/Profiler.h"
+#include "ViewControllers/GameViewController.h"
+
+HeadlessRunner::HeadlessRunner(
+    const std::string & settingsFile,
+    const std::string & mapFile,
+    unsigned long gamesAmount,
+    unsigned int gameDifficulty,
+    unsigned int plannerSeed)
+    :
+    settingsPath(settingsFile),
+    mapPath(mapFile),
+    games(gamesAmount),
+    difficulty(gameDifficulty),
+    seed(plannerSeed) { }
+
+int HeadlessRunner::run(std::ostream & out) {
+    std::pair<unsigned int, double> difficultyParameters = GameViewController::getDifficultyParameters(difficulty);
+    if (difficultyParameters.first == 0) {
+        out << "Unknown difficulty " << difficulty << std::endl;
+        return 1;
+    }
+
+    GameSettings settings;
+    Board board;
+    try {
+        GameSettingsRecordsFileLoader settingsLoader(settingsPath);
+        settings = settingsLoader.loadSettingsAndRecords().first;
+
+        BoardFileLoader boardLoader(mapPath);
+        board = boardLoader.loadBoard();
+    }
+    catch (FileLoaderException & e) {
+        out << "Couldn't load settings or map file: " << e.what() << std::endl;
+        return 1;
+    }
+
+    Autopilot autopilot;
+    unsigned long long totalSteps = 0;
+    unsigned long long totalScore = 0;
+    unsigned long won = 0;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    for (unsigned long g = 0; g < games; g++) {
+        Game game(settings, difficultyParameters.second, difficultyParameters.first, difficulty, true, seed + g);
+        game.loadBoard(board);
+        game.restart();
+
+        unsigned long steps = 0;
+        while (game.getLives() != 0 && game.getCoinsRemaining() != 0
+            && (unsigned long long) steps * HEADLESSSTEP < HEADLESSMAXGAMETIME) {
+            game.update(autopilot.getPlayerRotation(game));
+            if (game.isPaused()) { //< Game pauses after player dies, continue without key press
+                game.togglePause();
+            }
+            game.advanceTime(HEADLESSSTEP);
+            steps++;
+        }
+
+        out << "game " << g + 1 << ": score " << game.getScore()
+            << ", lives " << game.getLives()
+            << ", coins remaining " << game.getCoinsRemaining()
+            << ", game time " << (steps * HEADLESSSTEP) / 1000.0 << " s" << std::endl;
+
+        for (auto & trigger : game.getTriggerLateness()) {
+            Profiler::recordLateness(trigger.name, trigger.performed, trigger.skipped);
+        }
+
+        totalSteps += steps;
+        totalScore += game.getScore();
+        if (game.getCoinsRemaining() == 0) {
+            won++;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    out << "games: " << games << " (won " << won << ")" << std::endl;
+    if (games != 0) {
+        out << "average score: " << (double) totalScore / games << std::endl;
+    }
+    out << "steps: " << totalSteps << " in " << seconds << " s";
+    if (seconds > 0) {
+        out << " (" << totalSteps / seconds << " steps/s)";
+    }
+    out << std::endl;
+    out << "autopilot decisions: " << autopilot.getDecisions()
+        << ", average " << autopilot.getAverageDecisionTime() << " us"
+        << ", max " << autopilot.getMaxDecisionTime() << " us" << std::endl;
+
+    return 0;
+}
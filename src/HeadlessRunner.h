@@ -0,0 +1,65 @@
+/****************************************************************
+ * @file HeadlessRunner.h
+ * @author Michal Dobes
+ * @brief Headless runner
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef HEADLESSRUNNER_H
+#define HEADLESSRUNNER_H
+
+#define HEADLESSSTEP 10 //< Game time in milliseconds simulated by one step
+#define HEADLESSMAXGAMETIME 3600000 //< Maximal game time of one game in milliseconds
+
+#include <ostream>
+#include <string>
+
+#include "GameLogic/AI/GhostPlanner.h"
+
+/**
+ * @brief Headless runner
+ *
+ * Plays games without display, player is controlled by Autopilot. Game time is
+ * stepped manually, so games run as fast as possible.
+ *
+ * Used for throughput benchmarks and soak tests.
+ *
+ */
+class HeadlessRunner {
+private:
+    std::string settingsPath; //< Path to settings file
+    std::string mapPath; //< Path to map file
+    unsigned long games; //< Amount of games to play
+    unsigned int difficulty; //< Difficulty of games
+    unsigned int seed; //< Seed of planning of ghosts in the first game
+
+public:
+    /**
+     * @brief Construct a new Headless Runner object
+     *
+     * @param settingsFile path to settings file
+     * @param mapFile path to map file
+     * @param gamesAmount amount of games to play
+     * @param gameDifficulty difficulty of games (see GameViewController::getDifficultyParameters)
+     * @param plannerSeed seed of planning of ghosts in the first game, each next game uses next seed
+     */
+    HeadlessRunner(
+        const std::string & settingsFile,
+        const std::string & mapFile,
+        unsigned long gamesAmount = 1,
+        unsigned int gameDifficulty = 1,
+        unsigned int plannerSeed = GHOSTPLANNERDEFAULTSEED);
+
+    /**
+     * @brief Play games and report results
+     *
+     * @param out stream into which to report
+     * @return int exit code, 0 on success
+     */
+    int run(std::ostream & out);
+};
+
+#endif /* HEADLESSRUNNER_H */
@@ -0,0 +1,499 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <ncurses.h>
+#include <optional>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "LatencyRunner.h"
+#include "GameLogic/MazeGenerator.h"
+#include "Utilities/TerminalScreen.h"
+#include "Utilities/FileManagers/BoardFileSaver.h"
+
+namespace {
+    typedef std::chrono::steady_clock steadyclock;
+
+    /**
+     * @brief Process running in pseudo-terminal
+     *
+     */
+    class PseudoTerminalProcess {
+    private:
+        int master; //< Master side of pseudo-terminal
+        pid_t pid; //< Process
+
+    public:
+        /**
+         * @brief Construct a new Pseudo Terminal Process object and start program
+         *
+         * @throws std::runtime_error pseudo-terminal or process couldn't be created
+         *
+         * @param program absolute path to program
+         * @param directory working directory of program
+         * @param lines lines of terminal
+         * @param columns columns of terminal
+         */
+        PseudoTerminalProcess(const std::string & program, const std::string & directory, int lines, int columns)
+            : master(-1), pid(-1) {
+            master = posix_openpt(O_RDWR | O_NOCTTY);
+            if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+                if (master >= 0) {
+                    close(master);
+                }
+                throw std::runtime_error("pseudo-terminal couldn't be created");
+            }
+            std::string slavePath = ptsname(master);
+
+            pid = fork();
+            if (pid < 0) {
+                close(master);
+                throw std::runtime_error("process couldn't be created");
+            }
+
+            if (pid == 0) { //< Child becomes session leader with pseudo-terminal as controlling terminal
+                setsid();
+                int slave = open(slavePath.c_str(), O_RDWR);
+                if (slave < 0) {
+                    _exit(127);
+                }
+                ioctl(slave, TIOCSCTTY, 0);
+                struct winsize size = { (unsigned short) lines, (unsigned short) columns, 0, 0 };
+                ioctl(slave, TIOCSWINSZ, &size);
+                dup2(slave, STDIN_FILENO);
+                dup2(slave, STDOUT_FILENO);
+                dup2(slave, STDERR_FILENO);
+                close(slave);
+                close(master);
+
+                if (chdir(directory.c_str()) != 0) {
+                    _exit(127);
+                }
+                setenv("TERM", "xterm-256color", 1);
+                execl(program.c_str(), program.c_str(), (char *) nullptr);
+                _exit(127);
+            }
+        }
+
+        /**
+         * @brief Destroy the Pseudo Terminal Process object and kill program
+         *
+         */
+        ~PseudoTerminalProcess() {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+            close(master);
+        }
+
+        PseudoTerminalProcess(const PseudoTerminalProcess &) = delete;
+        PseudoTerminalProcess & operator = (const PseudoTerminalProcess &) = delete;
+
+        /**
+         * @brief Write input of program
+         *
+         * @param input input
+         */
+        void write(const std::string & input) {
+            size_t written = 0;
+            while (written < input.size()) {
+                ssize_t result = ::write(master, input.data() + written, input.size() - written);
+                if (result < 0 && errno != EINTR) {
+                    return;
+                }
+                written += std::max<ssize_t>(0, result);
+            }
+        }
+
+        /**
+         * @brief Read output of program, waiting at most given time
+         *
+         * @param buffer buffer
+         * @param size size of buffer
+         * @param timeout maximal time of waiting
+         * @return ssize_t read bytes, 0 if nothing was written in time, -1 if program ended
+         */
+        ssize_t read(char * buffer, size_t size, steadyclock::duration timeout) {
+            struct pollfd descriptor = { master, POLLIN, 0 };
+            struct timespec wait;
+            auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(timeout, steadyclock::duration::zero()));
+            wait.tv_sec = nanoseconds.count() / 1000000000;
+            wait.tv_nsec = nanoseconds.count() % 1000000000;
+
+            int ready = ppoll(&descriptor, 1, &wait, nullptr);
+            if (ready < 0) {
+                return (errno == EINTR) ? 0 : -1;
+            }
+            if (ready == 0) {
+                return 0;
+            }
+            ssize_t result = ::read(master, buffer, size);
+            return (result <= 0) ? -1 : result;
+        }
+    };
+
+    /**
+     * @brief Game running in pseudo-terminal with interpreted screen
+     *
+     */
+    class Session {
+    private:
+        PseudoTerminalProcess process; //< Game
+        TerminalScreen screen; //< Screen of game
+
+        bool ended; //< Game ended
+        std::optional<std::pair<size_t, size_t>> playerPosition; //< Last drawn position of player glyph
+        steadyclock::time_point playerMoveTime; //< Time of last drawn movement of player
+
+        bool measuring; //< Screen updates and movements are counted
+        bool movedWhileMeasuring; //< Player moved since measuring started
+        steadyclock::time_point measuringStart; //< Time when measuring started
+        steadyclock::time_point lastOutputTime; //< Time of last output
+
+    public:
+        std::vector<double> moveIntervals; //< Milliseconds between movements while measuring
+        size_t screenUpdates; //< Screen updates while measuring
+        size_t outputBytes; //< Bytes of output while measuring
+        steadyclock::duration measuredTime; //< Time of measuring
+
+        /**
+         * @brief Construct a new Session object and start game
+         *
+         * @param program absolute path to game
+         * @param directory working directory of game
+         */
+        Session(const std::string & program, const std::string & directory)
+            :
+            process(program, directory, LATENCYLINES, LATENCYCOLUMNS),
+            screen(LATENCYLINES, LATENCYCOLUMNS),
+            ended(false),
+            measuring(false),
+            movedWhileMeasuring(false),
+            screenUpdates(0),
+            outputBytes(0),
+            measuredTime(steadyclock::duration::zero()) { }
+
+        /**
+         * @brief Press keys
+         *
+         * @param keys keys
+         */
+        void press(const std::string & keys) {
+            process.write(keys);
+        }
+
+        /**
+         * @brief Count screen updates and movements of player
+         *
+         * @param on count
+         */
+        void setMeasuring(bool on) {
+            if (on && !measuring) {
+                measuringStart = steadyclock::now();
+                movedWhileMeasuring = false;
+            } else if (!on && measuring) {
+                measuredTime += steadyclock::now() - measuringStart;
+            }
+            measuring = on;
+        }
+
+        /**
+         * @brief Interpret output of game until condition holds or time passes
+         *
+         * @param condition condition checked after each output
+         * @param timeout maximal time
+         * @return true condition holds
+         * @return false time passed or game ended
+         */
+        bool waitUntil(const std::function<bool()> & condition, steadyclock::duration timeout) {
+            steadyclock::time_point end = steadyclock::now() + timeout;
+            char buffer[65536];
+
+            while (!ended) {
+                if (condition()) {
+                    return true;
+                }
+                steadyclock::time_point now = steadyclock::now();
+                if (now >= end) {
+                    return false;
+                }
+
+                ssize_t size = process.read(buffer, sizeof(buffer), end - now);
+                if (size < 0) {
+                    ended = true;
+                    break;
+                }
+                if (size == 0) {
+                    continue;
+                }
+
+                now = steadyclock::now();
+                if (measuring) {
+                    if (now - lastOutputTime > std::chrono::microseconds(LATENCYQUIETTIME)) {
+                        screenUpdates++;
+                    }
+                    outputBytes += size;
+                }
+                lastOutputTime = now;
+
+                screen.feed(buffer, size);
+                for (const TerminalScreen::Write & write : screen.takeWrites()) {
+                    bool glyph = write.character == '<' || write.character == '>'
+                        || write.character == '^' || write.character == 'v';
+                    if (!glyph || write.foreground != COLOR_YELLOW) {
+                        continue;
+                    }
+
+                    std::pair<size_t, size_t> position(write.line, write.column);
+                    if (playerPosition && *playerPosition == position) {
+                        continue; //< Player only turned or was redrawn
+                    }
+                    if (measuring && movedWhileMeasuring) { //< Intervals over pauses are left out
+                        moveIntervals.push_back(std::chrono::duration<double, std::milli>(now - playerMoveTime).count());
+                    }
+                    movedWhileMeasuring = measuring;
+                    playerPosition = position;
+                    playerMoveTime = now;
+                }
+            }
+            return condition();
+        }
+
+        /**
+         * @brief Interpret output of game for given time
+         *
+         * @param time time
+         */
+        void play(steadyclock::duration time) {
+            waitUntil([ ]() { return false; }, time);
+        }
+
+        /**
+         * @brief Does screen contain text
+         *
+         * @param text text
+         * @return true
+         * @return false
+         */
+        bool shows(const std::string & text) const {
+            return screen.contains(text);
+        }
+
+        /**
+         * @brief Get last drawn position of player glyph
+         *
+         * @return std::optional<std::pair<size_t, size_t>> empty if player wasn't drawn yet
+         */
+        std::optional<std::pair<size_t, size_t>> getPlayerPosition() const {
+            return playerPosition;
+        }
+
+        /**
+         * @brief Has game ended
+         *
+         * @return true
+         * @return false
+         */
+        bool hasEnded() const {
+            return ended;
+        }
+    };
+
+    /**
+     * @brief Get value below which is given percentage of values
+     *
+     * @param values values
+     * @param percent percentage from 0 to 100
+     * @return double 0 if values are empty
+     */
+    double percentile(std::vector<double> values, double percent) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        size_t rank = std::max<size_t>(1, (size_t)((percent / 100.0) * values.size() + 0.5));
+        return values[std::min(rank, values.size()) - 1];
+    }
+
+    /**
+     * @brief Write count, median, 95th percentile and maximum of values
+     *
+     * @param out stream to write into
+     * @param name name of values
+     * @param values values in milliseconds
+     */
+    void writeValues(std::ostream & out, const std::string & name, const std::vector<double> & values) {
+        out << "  " << std::left << std::setw(16) << name << std::right
+            << std::setw(6) << values.size()
+            << std::setw(10) << percentile(values, 50)
+            << std::setw(10) << percentile(values, 95)
+            << std::setw(10) << percentile(values, 100) << '\n';
+    }
+}
+
+LatencyRunner::LatencyRunner(
+    const std::string & program,
+    const std::string & examplesDirectory,
+    const std::vector<std::pair<size_t, size_t>> & sizes,
+    unsigned int samplesAmount)
+    :
+    programPath(program),
+    examplesPath(examplesDirectory),
+    mapSizes(sizes),
+    samples(samplesAmount),
+    temporaryPath((std::filesystem::temp_directory_path() / ("dobesmic_latency_" + std::to_string(getpid()))).string()) { }
+
+int LatencyRunner::run(std::ostream & out) {
+    std::string program;
+    try {
+        program = std::filesystem::canonical(programPath).string();
+    }
+    catch (std::filesystem::filesystem_error & e) {
+        out << "Couldn't find game " << programPath << std::endl;
+        return 1;
+    }
+
+    // Ghosts move once an hour and are released after an hour, so player never dies
+    std::string settings;
+    {
+        std::ifstream defaultSettings(examplesPath + "/Settings/default.spac");
+        std::string line;
+        while (std::getline(defaultSettings, line)) {
+            if (line.find('>') == std::string::npos) {
+                continue; //< Records are left out
+            }
+            if (line.rfind("ghost_periodspeed>", 0) == 0) {
+                line = "ghost_periodspeed>\t3600000";
+            } else if (line.rfind("ghost_begin_period>", 0) == 0) {
+                line = "ghost_begin_period>\t3600000";
+            }
+            settings += line + '\n';
+        }
+        if (settings.empty()) {
+            out << "Couldn't read settings of examples" << std::endl;
+            return 1;
+        }
+    }
+
+    int exitCode = 0;
+    out << std::fixed << std::setprecision(1);
+
+    for (auto & size : mapSizes) {
+        bool defaultMap = size.first == 0 || size.second == 0;
+        std::string mapName = defaultMap ? "default" : std::to_string(size.first) + "x" + std::to_string(size.second);
+        std::filesystem::path directory = std::filesystem::path(temporaryPath) / mapName;
+
+        // Game directory with only one settings file and one map, so menus are confirmed by enter
+        try {
+            std::filesystem::create_directories(directory / "examples" / "Settings");
+            std::filesystem::create_directories(directory / "examples" / "Maps");
+            std::ofstream(directory / "examples" / "Settings" / "latency.spac") << settings;
+
+            std::filesystem::path mapPath = directory / "examples" / "Maps" / (mapName + ".mpac");
+            if (defaultMap) {
+                std::filesystem::copy_file(examplesPath + "/Maps/default.mpac", mapPath);
+            } else {
+                MazeGenerator generator(size.first, size.second, 0.7, MazeGenerator::Symmetry::mirror, 1);
+                BoardFileSaver saver(mapPath.string(), false);
+                saver.writeBoard(generator.generate());
+            }
+        }
+        catch (std::exception & e) { //< Includes FileLoaderException and filesystem errors
+            out << mapName << ": FAILED, couldn't prepare map: " << e.what() << std::endl;
+            exitCode = 1;
+            continue;
+        }
+
+        std::vector<double> pauseLatencies;
+        std::vector<double> moveLatencies;
+        const steadyclock::duration timeout = std::chrono::milliseconds(LATENCYTIMEOUT);
+
+        try {
+            Session session(program, directory.string());
+
+            // Main menu, difficulty, settings file and map
+            bool started = true;
+            for (const char * title : { "play", "CHOOSE DIFFICULTY", "CHOOSE SETTINGS FILE", "CHOOSE MAP FILE" }) {
+                if (!session.waitUntil([ &session, title ]() { return session.shows(title); }, timeout)) {
+                    started = false;
+                    break;
+                }
+                session.press("\r");
+            }
+            if (!started || !session.waitUntil([ &session ]() {
+                return session.getPlayerPosition() && session.shows("paused");
+                }, timeout)) {
+                out << mapName << ": FAILED, game didn't start" << std::endl;
+                exitCode = 1;
+                continue;
+            }
+
+            const std::string directions = "adws";
+            size_t direction = 0;
+            // Attempts are limited, player in dead end may need several direction keys
+            for (unsigned int s = 0; s < 4 * samples && pauseLatencies.size() < samples
+                && !session.hasEnded() && !session.shows("GAME OVER"); s++) {
+                // Direction key unpauses game, player moves at its next movement
+                std::optional<std::pair<size_t, size_t>> from = session.getPlayerPosition();
+                steadyclock::time_point pressed = steadyclock::now();
+                session.setMeasuring(true);
+                session.press(std::string(1, directions[direction++ % directions.size()]));
+                if (!session.waitUntil([ &session, from ]() { return session.getPlayerPosition() != from; }, timeout)) {
+                    session.setMeasuring(false);
+                    continue; //< Player can't move, another direction is tried
+                }
+                moveLatencies.push_back(std::chrono::duration<double, std::milli>(steadyclock::now() - pressed).count());
+
+                session.play(std::chrono::milliseconds(200 + (s * 37) % 400));
+                if (session.shows("paused")) { //< Player died
+                    session.setMeasuring(false);
+                    continue;
+                }
+
+                pressed = steadyclock::now();
+                session.press("p");
+                bool paused = session.waitUntil([ &session ]() { return session.shows("paused"); }, timeout);
+                session.setMeasuring(false);
+                if (paused) {
+                    pauseLatencies.push_back(std::chrono::duration<double, std::milli>(steadyclock::now() - pressed).count());
+                }
+            }
+
+            session.setMeasuring(false);
+            double seconds = std::chrono::duration<double>(session.measuredTime).count();
+
+            out << mapName << ":\n";
+            out << "  " << std::left << std::setw(16) << "[ms]" << std::right
+                << std::setw(6) << "count" << std::setw(10) << "p50" << std::setw(10) << "p95"
+                << std::setw(10) << "max" << '\n';
+            writeValues(out, "pause latency", pauseLatencies);
+            writeValues(out, "move latency", moveLatencies);
+            writeValues(out, "move interval", session.moveIntervals);
+            out << "  screen updates " << session.screenUpdates << ", "
+                << (seconds > 0 ? session.screenUpdates / seconds : 0) << " per second of play, "
+                << (session.screenUpdates > 0 ? (double) session.outputBytes / session.screenUpdates : 0)
+                << " bytes per update" << std::endl;
+
+            if (pauseLatencies.empty()) {
+                exitCode = 1;
+            }
+        }
+        catch (std::runtime_error & e) {
+            out << mapName << ": FAILED, " << e.what() << std::endl;
+            exitCode = 1;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::remove_all(temporaryPath, error);
+    return exitCode;
+}
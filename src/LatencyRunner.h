@@ -0,0 +1,79 @@
+/****************************************************************
+ * @file LatencyRunner.h
+ * @author Michal Dobes
+ * @brief End to end input latency benchmark through pseudo-terminal
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef LATENCYRUNNER_H
+#define LATENCYRUNNER_H
+
+#define LATENCYSAMPLES 20 //< Default number of key presses measured on each map
+#define LATENCYLINES 50 //< Lines of pseudo-terminal
+#define LATENCYCOLUMNS 160 //< Columns of pseudo-terminal
+#define LATENCYTIMEOUT 5000 //< Milliseconds to wait for reaction of game
+#define LATENCYQUIETTIME 1000 //< Microseconds without output that separate screen updates
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief End to end input latency benchmark through pseudo-terminal
+ *
+ * Launches the game binary in pseudo-terminal, walks menus and plays each map
+ * by scripted key presses, while output of game is interpreted by TerminalScreen.
+ *
+ * For each map it measures:
+ *  - pause latency: from pressing 'p' to "paused" appearing on screen, which
+ *    is time from key press to drawn reaction (polling of input, update,
+ *    drawing and screen update),
+ *  - move latency: from pressing direction key (which also unpauses game) to
+ *    the player glyph (<, >, ^, v in player color) being drawn at new position,
+ *    which includes waiting for next movement of player,
+ *  - interval between movements of player glyph while playing,
+ *  - screen updates per second and bytes per screen update while playing
+ *    (bursts of output separated by LATENCYQUIETTIME).
+ *
+ * Game runs in temporary directory with one settings file (ghosts effectively
+ * don't move, so player doesn't die) and one map, the default map or maze
+ * generated by MazeGenerator.
+ *
+ */
+class LatencyRunner {
+private:
+    std::string programPath; //< Path to game binary
+    std::string examplesPath; //< Path to directory with examples (default map and settings)
+    std::vector<std::pair<size_t, size_t>> mapSizes; //< Sizes of generated maps, 0x0 is default map
+    unsigned int samples; //< Number of key presses measured on each map
+    std::string temporaryPath; //< Path to directory for game directories
+
+public:
+    /**
+     * @brief Construct a new Latency Runner object
+     *
+     * @param program path to game binary
+     * @param examplesDirectory path to directory with examples (Maps and Settings)
+     * @param sizes sizes of generated maps, 0x0 uses default map of examples
+     * @param samplesAmount number of key presses measured on each map
+     */
+    LatencyRunner(
+        const std::string & program,
+        const std::string & examplesDirectory,
+        const std::vector<std::pair<size_t, size_t>> & sizes,
+        unsigned int samplesAmount = LATENCYSAMPLES);
+
+    /**
+     * @brief Measure all maps and report results
+     *
+     * @param out stream into which to report
+     * @return int exit code, 0 if all maps were measured
+     */
+    int run(std::ostream & out);
+};
+
+#endif /* LATENCYRUNNER_H */
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <filesystem>
+#include <future>
+#include <sstream>
+#include <vector>
+
+#include "MapAnalyzer.h"
+#include "GameLogic/MapAnalysis.h"
+#include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/ThreadPool.h"
+
+MapAnalyzer::MapAnalyzer(const std::string & directory, size_t threadsAmount)
+    :
+    directoryPath(directory),
+    threads(threadsAmount) { }
+
+int MapAnalyzer::run(std::ostream & out) {
+    std::vector<std::string> paths;
+    try {
+        for (auto & entry : std::filesystem::directory_iterator(directoryPath)) {
+            if (entry.is_regular_file()
+                && (entry.path().extension() == ".mpac" || entry.path().extension() == ".mpacb")) {
+                paths.push_back(entry.path().string());
+            }
+        }
+    }
+    catch (std::filesystem::filesystem_error & e) {
+        out << "Couldn't read directory: " << e.what() << std::endl;
+        return 1;
+    }
+    std::sort(paths.begin(), paths.end());
+
+    // Each task loads and analyzes one map, result is whether map is playable and its report
+    typedef std::pair<bool, std::string> Report;
+    std::vector<std::future<Report>> reports;
+    ThreadPool pool(threads);
+
+    for (auto & path : paths) {
+        reports.push_back(pool.submit([ path ]() {
+            std::ostringstream report;
+            report << path << ": ";
+
+            try {
+                BoardFileLoader loader(path);
+                Board board = loader.loadBoard();
+                MapAnalysis analysis(board);
+
+                report << (analysis.isPlayable() ? "playable" : "UNPLAYABLE")
+                    << ", " << board.getSizeX() << "x" << board.getSizeY()
+                    << ", coins " << analysis.reachableCoins << "/" << analysis.coins << " reachable"
+                    << ", pellets " << analysis.reachableFrightens << "/" << analysis.frightens << " reachable"
+                    << ", enemy spawn " << (analysis.enemySpawnReachable ? "reachable" : "UNREACHABLE")
+                    << ", dead ends " << analysis.deadEnds
+                    << ", crossroads " << analysis.crossroads
+                    << ", corridors " << analysis.corridors
+                    << " (length min " << analysis.minCorridorLength
+                    << ", avg " << analysis.averageCorridorLength
+                    << ", max " << analysis.maxCorridorLength << ")";
+                return Report(analysis.isPlayable(), report.str());
+            }
+            catch (FileLoaderException & e) {
+                report << "FAILED, " << e.what();
+            }
+            catch (std::invalid_argument & e) { //< Thrown by Board for invalid spawns
+                report << "FAILED, " << e.what();
+            }
+            return Report(false, report.str());
+            }));
+    }
+
+    size_t playable = 0;
+    for (auto & report : reports) {
+        Report result = report.get();
+        out << result.second << std::endl;
+        playable += result.first ? 1 : 0;
+    }
+
+    out << "maps: " << paths.size() << " (playable " << playable << ", threads " << pool.size() << ")" << std::endl;
+
+    return (playable == paths.size()) ? 0 : 1;
+}
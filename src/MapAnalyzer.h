@@ -0,0 +1,49 @@
+/****************************************************************
+ * @file MapAnalyzer.h
+ * @author Michal Dobes
+ * @brief Analyzer of directory of maps
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPANALYZER_H
+#define MAPANALYZER_H
+
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Analyzer of directory of maps
+ *
+ * Loads each map file in directory and reports its MapAnalysis. Maps are loaded
+ * and analyzed in parallel on thread pool, reports are in order of file names.
+ *
+ * Used for vetting maps before they are played.
+ *
+ */
+class MapAnalyzer {
+private:
+    std::string directoryPath; //< Path to directory with maps
+    size_t threads; //< Number of threads, if 0 number of hardware threads
+
+public:
+    /**
+     * @brief Construct a new Map Analyzer object
+     *
+     * @param directory path to directory with maps
+     * @param threadsAmount number of threads, if 0 number of hardware threads is used
+     */
+    MapAnalyzer(const std::string & directory, size_t threadsAmount = 0);
+
+    /**
+     * @brief Analyze maps and report results
+     *
+     * @param out stream into which to report
+     * @return int exit code, 0 if all maps were loaded and are playable
+     */
+    int run(std::ostream & out);
+};
+
+#endif /* MAPANALYZER_H */
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <sstream>
+#include <vector>
+
+#include "MapGenerator.h"
+#include "Utilities/FileManagers/BoardFileSaver.h"
+#include "Utilities/ThreadPool.h"
+
+MapGenerator::MapGenerator(
+    const std::string & directory,
+    unsigned long mapsAmount,
+    size_t dimensionX,
+    size_t dimensionY,
+    double wallDensity,
+    MazeGenerator::Symmetry mapsSymmetry,
+    unsigned long firstSeed,
+    bool binaryFormat,
+    size_t threadsAmount)
+    :
+    directoryPath(directory),
+    maps(mapsAmount),
+    sizeX(dimensionX),
+    sizeY(dimensionY),
+    density(wallDensity),
+    symmetry(mapsSymmetry),
+    seed(firstSeed),
+    binary(binaryFormat),
+    threads(threadsAmount) { }
+
+int MapGenerator::run(std::ostream & out) {
+    try {
+        std::filesystem::create_directories(directoryPath);
+    }
+    catch (std::filesystem::filesystem_error & e) {
+        out << "Couldn't create directory: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    // Each task generates and writes one map, result is number of written tiles and report
+    typedef std::pair<size_t, std::string> Report;
+    std::vector<std::future<Report>> reports;
+    ThreadPool pool(threads);
+
+    for (unsigned long m = 0; m < maps; m++) {
+        reports.push_back(pool.submit([ this, m ]() {
+            std::filesystem::path path(directoryPath);
+            path /= "maze_" + std::to_string(seed + m) + (binary ? ".mpacb" : ".mpac");
+
+            std::ostringstream report;
+            report << path.string() << ": ";
+
+            try {
+                MazeGenerator generator(sizeX, sizeY, density, symmetry, seed + m);
+                Board board = generator.generate();
+
+                BoardFileSaver saver(path.string(), binary);
+                saver.writeBoard(board);
+
+                report << board.getSizeX() << "x" << board.getSizeY() << ", coins " << board.getNumberOfCoins();
+                return Report(board.getSizeX() * board.getSizeY(), report.str());
+            }
+            catch (FileLoaderException & e) {
+                report << "FAILED, " << e.what();
+            }
+            catch (std::invalid_argument & e) { //< Thrown by generator for invalid size
+                report << "FAILED, " << e.what();
+            }
+            return Report(0, report.str());
+            }));
+    }
+
+    unsigned long written = 0;
+    size_t tiles = 0;
+    for (auto & report : reports) {
+        Report result = report.get();
+        out << result.second << std::endl;
+        written += (result.first != 0) ? 1 : 0;
+        tiles += result.first;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    out << "maps: " << maps << " (written " << written << ", threads " << pool.size() << ")" << std::endl;
+    out << "tiles: " << tiles << " in " << seconds << " s (" << ((seconds > 0) ? tiles / seconds : 0) << " tiles/s)" << std::endl;
+
+    return (written == maps) ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+/****************************************************************
+ * @file MapGenerator.h
+ * @author Michal Dobes
+ * @brief Generator of directory of maps
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPGENERATOR_H
+#define MAPGENERATOR_H
+
+#include <ostream>
+#include <string>
+
+#include "GameLogic/MazeGenerator.h"
+
+/**
+ * @brief Generator of directory of maps
+ *
+ * Generates maps using MazeGenerator in parallel on thread pool, each map is
+ * written to its own file as soon as it is generated. Map with index i is
+ * generated with seed + i and named maze_<seed + i>.
+ *
+ * Used for creating large and varied maps for benchmarks.
+ *
+ */
+class MapGenerator {
+private:
+    std::string directoryPath; //< Path to directory for maps
+    unsigned long maps; //< Amount of maps to generate
+    size_t sizeX; //< Size of maps in x dimension
+    size_t sizeY; //< Size of maps in y dimension
+    double density; //< Wall density of maps (see MazeGenerator)
+    MazeGenerator::Symmetry symmetry; //< Symmetry of maps
+    unsigned long seed; //< Seed of the first map
+    bool binary; //< Save in binary format
+    size_t threads; //< Number of threads, if 0 number of hardware threads
+
+public:
+    /**
+     * @brief Construct a new Map Generator object
+     *
+     * @param directory path to directory for maps
+     * @param mapsAmount amount of maps to generate
+     * @param dimensionX size of maps in x dimension
+     * @param dimensionY size of maps in y dimension
+     * @param wallDensity wall density of maps (see MazeGenerator)
+     * @param mapsSymmetry symmetry of maps
+     * @param firstSeed seed of the first map
+     * @param binaryFormat save maps in binary format (.mpacb), else in text (.mpac)
+     * @param threadsAmount number of threads, if 0 number of hardware threads is used
+     */
+    MapGenerator(
+        const std::string & directory,
+        unsigned long mapsAmount,
+        size_t dimensionX,
+        size_t dimensionY,
+        double wallDensity,
+        MazeGenerator::Symmetry mapsSymmetry,
+        unsigned long firstSeed,
+        bool binaryFormat,
+        size_t threadsAmount = 0);
+
+    /**
+     * @brief Generate maps and report results
+     *
+     * @param out stream into which to report
+     * @return int exit code, 0 if all maps were written
+     */
+    int run(std::ostream & out);
+};
+
+#endif /* MAPGENERATOR_H */
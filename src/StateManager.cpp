@@ -3,15 +3,18 @@
 #include "StateManager.h"
 #include "ViewControllers/GameViewController.h"
 #include "ViewControllers/MainMenuViewController.h"
+#include "Utilities/Tracer.h"
 
 #define STATEMANAGERLOOPDELAY 100000
 
 void StateManager::handleState(AppState state) {
     switch (state) {
         case AppState::mainmenu:
+            Tracer::instant("state", "main menu");
             viewController.reset(new MainMenuViewController());
             break;
         case AppState::game:
+            Tracer::instant("state", "game");
             viewController.reset(new GameViewController());
             break;
         default:
@@ -20,6 +23,7 @@ void StateManager::handleState(AppState state) {
 }
 
 StateManager::StateManager() {
+    Tracer::instant("state", "main menu");
     viewController.reset(new MainMenuViewController());
 }
 
@@ -33,6 +37,7 @@ void StateManager::run() {
         if (nextState == AppState::programContinue) {
             continue;
         } else if (nextState == AppState::programExit) {
+            Tracer::instant("state", "exit");
             return;
         } else {
             handleState(nextState);
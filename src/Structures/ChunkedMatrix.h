@@ -0,0 +1,360 @@
+/****************************************************************
+ * @file ChunkedMatrix.h
+ * @author Michal Dobes
+ * @brief Matrix container stored in chunks
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef CHUNKEDMATRIX_H
+#define CHUNKEDMATRIX_H
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#define CHUNKEDMATRIXCHUNKBITS 6 //< Chunk has 2^bits elements in each dimension
+
+/**
+ * @brief Matrix container stored in chunks
+ *
+ * Two dimensional array split into square chunks, elements of chunk are stored
+ * lineary by rows. Chunks are ordered along Z-order curve (inside squares of chunks
+ * with side of power of two, squares are ordered by rows), so chunks close
+ * in board are close in memory.
+ *
+ * Chunks whose elements all have the same value share one immutable instance.
+ * New matrix has all chunks shared, chunk is allocated only when an element in it
+ * changes (and copied, if it is shared). Use compact() to share chunks that
+ * became uniform.
+ *
+ * Copying the matrix shares chunks with original, they are copied on write.
+ * Writes are not thread safe, concurrent reads are.
+ *
+ * Template paremeter T needs to have at least:
+ *  - Default constructor (without explicit parameters)
+ *  - Assignment operator
+ *  - Equality operator
+ *
+ * @tparam T Type of data to be stored in matrix
+ */
+template <typename T>
+class ChunkedMatrix {
+public:
+    static constexpr size_t chunkSide = (size_t)1 << CHUNKEDMATRIXCHUNKBITS; //< Elements in one dimension of chunk
+
+private:
+    static constexpr size_t chunkMask = chunkSide - 1;
+
+    /**
+     * @brief Elements of chunk
+     *
+     */
+    struct Chunk {
+        T data[chunkSide * chunkSide]; //< Elements stored lineary by rows
+    };
+
+    size_t sizeX; //< Size in x dimension
+    size_t sizeY; //< Size in y dimension
+
+    std::vector<std::shared_ptr<Chunk>> chunks; //< Chunks in Z-order
+    std::vector<std::shared_ptr<Chunk>> uniformChunks; //< Shared instances of uniform chunks,
+    // at most one for each value, kept here so they are never written to
+
+    std::vector<size_t> columnSlot; //< Part of index of chunk given by its column
+    std::vector<size_t> rowSlot; //< Part of index of chunk given by its row
+
+    /**
+     * @brief Interleave bits of value with zeros
+     *
+     * @param value value
+     * @return size_t value with bit i moved to bit 2i
+     */
+    static size_t spreadBits(size_t value) {
+        size_t result = 0;
+        for (size_t bit = 0; (value >> bit) != 0; bit++) {
+            result |= ((value >> bit) & 1) << (2 * bit);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Get index of chunk containing element at coordinates
+     *
+     * @param x Coordinate x
+     * @param y Coordinate y
+     * @return size_t Index in ChunkedMatrix::chunks
+     */
+    size_t chunkIndexFor(size_t x, size_t y) const {
+        return columnSlot[x >> CHUNKEDMATRIXCHUNKBITS] + rowSlot[y >> CHUNKEDMATRIXCHUNKBITS];
+    }
+
+    /**
+     * @brief Get index of element at coordinates inside its chunk
+     *
+     * @param x Coordinate x
+     * @param y Coordinate y
+     * @return size_t Index in Chunk::data
+     */
+    static size_t elementIndexFor(size_t x, size_t y) {
+        return ((y & chunkMask) << CHUNKEDMATRIXCHUNKBITS) + (x & chunkMask);
+    }
+
+    /**
+     * @brief Check coordinates
+     *
+     * @exception std::out_of_range Coordinates are not in range
+     *
+     * @param x Coordinate x
+     * @param y Coordinate y
+     */
+    void checkCoordinates(size_t x, size_t y) const {
+        if (x >= sizeX || y >= sizeY) {
+            throw std::out_of_range("chunkedmatrix: index out of range");
+        }
+    }
+
+    /**
+     * @brief Get shared instance of chunk with all elements equal to value
+     *
+     * @param value value of elements
+     * @return std::shared_ptr<Chunk>
+     */
+    std::shared_ptr<Chunk> uniformChunk(const T & value) {
+        for (auto & chunk : uniformChunks) {
+            if (chunk->data[0] == value) {
+                return chunk;
+            }
+        }
+
+        std::shared_ptr<Chunk> chunk = std::make_shared<Chunk>();
+        for (auto & element : chunk->data) {
+            element = value;
+        }
+        uniformChunks.push_back(chunk);
+        return chunk;
+    }
+
+    /**
+     * @brief Check if part of chunk inside of matrix has all elements equal
+     *
+     * @param chunkX Column of chunk
+     * @param chunkY Row of chunk
+     * @return true
+     * @return false
+     */
+    bool isChunkUniform(size_t chunkX, size_t chunkY) const {
+        size_t fromX = chunkX * chunkSide;
+        size_t fromY = chunkY * chunkSide;
+        size_t toX = std::min(fromX + chunkSide, sizeX);
+        size_t toY = std::min(fromY + chunkSide, sizeY);
+
+        const Chunk & chunk = *chunks[chunkIndexFor(fromX, fromY)];
+        const T & first = chunk.data[0];
+        for (size_t y = fromY; y < toY; y++) {
+            for (size_t x = fromX; x < toX; x++) {
+                if (!(chunk.data[elementIndexFor(x, y)] == first)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+public:
+
+    /**
+     * @brief Construct a new, empty Chunked Matrix object
+     *
+     */
+    ChunkedMatrix() : sizeX(0), sizeY(0) { }
+
+    /**
+     * @brief Construct a new Chunked Matrix object
+     *
+     * No chunk is allocated, all chunks share one instance.
+     *
+     * @exception std::invalid_argument Size is not valid
+     *
+     * @param dimensionX Size in dimension x
+     * @param dimensionY Size in dimension y
+     * @param fill Value of all elements
+     */
+    ChunkedMatrix(size_t dimensionX, size_t dimensionY, const T & fill = T()) : sizeX(dimensionX), sizeY(dimensionY) {
+        if (dimensionX <= 0 || dimensionY <= 0) {
+            throw std::invalid_argument("chunkedmatrix: invalid size");
+        }
+
+        size_t chunksX = ((dimensionX - 1) >> CHUNKEDMATRIXCHUNKBITS) + 1;
+        size_t chunksY = ((dimensionY - 1) >> CHUNKEDMATRIXCHUNKBITS) + 1;
+
+        // Z-order is used inside squares of chunks, side of square is the smallest
+        // power of two not smaller than shorter dimension, so long and narrow
+        // matrices don't waste indexes
+        size_t squareSide = 1;
+        while (squareSide < std::min(chunksX, chunksY)) {
+            squareSide <<= 1;
+        }
+        size_t squareArea = squareSide * squareSide;
+        size_t squaresX = ((chunksX - 1) / squareSide) + 1;
+        size_t squaresY = ((chunksY - 1) / squareSide) + 1;
+
+        columnSlot.resize(chunksX);
+        for (size_t x = 0; x < chunksX; x++) {
+            columnSlot[x] = ((x / squareSide) * squareArea) + spreadBits(x % squareSide);
+        }
+        rowSlot.resize(chunksY);
+        for (size_t y = 0; y < chunksY; y++) {
+            rowSlot[y] = ((y / squareSide) * squaresX * squareArea) + (spreadBits(y % squareSide) << 1);
+        }
+
+        chunks.resize(squaresX * squaresY * squareArea);
+        std::shared_ptr<Chunk> filled = uniformChunk(fill);
+        for (size_t y = 0; y < chunksY; y++) {
+            for (size_t x = 0; x < chunksX; x++) {
+                chunks[columnSlot[x] + rowSlot[y]] = filled;
+            }
+        }
+    }
+
+    /**
+     * @brief Get size in x dimension
+     *
+     * @return size_t Size in x dimension
+     */
+    size_t getSizeX() const {
+        return sizeX;
+    }
+
+    /**
+     * @brief Get size in y dimension
+     *
+     * @return size_t Size in y dimension
+     */
+    size_t getSizeY() const {
+        return sizeY;
+    }
+
+    /**
+     * @brief Get element at coordinates
+     *
+     * @exception std::out_of_range Coordinates are not in range
+     *
+     * @param x Coordinate x
+     * @param y Coordinate y
+     * @return const T& Element
+     */
+    const T & at(size_t x, size_t y) const {
+        checkCoordinates(x, y);
+        return chunks[chunkIndexFor(x, y)]->data[elementIndexFor(x, y)];
+    }
+
+    /**
+     * @brief Set element at coordinates
+     *
+     * Chunk is copied before the change, if it is shared.
+     *
+     * @exception std::out_of_range Coordinates are not in range
+     *
+     * @param x Coordinate x
+     * @param y Coordinate y
+     * @param value New value of element
+     */
+    void set(size_t x, size_t y, const T & value) {
+        checkCoordinates(x, y);
+
+        std::shared_ptr<Chunk> & chunk = chunks[chunkIndexFor(x, y)];
+        T & element = chunk->data[elementIndexFor(x, y)];
+        if (element == value) {
+            return;
+        }
+
+        if (chunk.use_count() > 1) {
+            chunk = std::make_shared<Chunk>(*chunk);
+        }
+        chunk->data[elementIndexFor(x, y)] = value;
+    }
+
+    /**
+     * @brief Copy part of row into array
+     *
+     * @exception std::out_of_range Part of row is not in range
+     *
+     * @param y Coordinate y of row
+     * @param fromX Coordinate x of first element
+     * @param count Number of elements
+     * @param into Array with space for count elements
+     */
+    void readRow(size_t y, size_t fromX, size_t count, T * into) const {
+        if (y >= sizeY || fromX > sizeX || count > sizeX - fromX) {
+            throw std::out_of_range("chunkedmatrix: row out of range");
+        }
+
+        size_t x = fromX;
+        while (x < fromX + count) {
+            // Copy elements until end of chunk at once
+            size_t inChunk = std::min(chunkSide - (x & chunkMask), (fromX + count) - x);
+            const T * source = &chunks[chunkIndexFor(x, y)]->data[elementIndexFor(x, y)];
+            for (size_t i = 0; i < inChunk; i++) {
+                into[i] = source[i];
+            }
+            into += inChunk;
+            x += inChunk;
+        }
+    }
+
+    /**
+     * @brief Share chunks whose elements became all equal
+     *
+     */
+    void compact() {
+        compactRows(0, sizeY);
+    }
+
+    /**
+     * @brief Share chunks with rows in range whose elements became all equal
+     *
+     * @param fromY Coordinate y of first row
+     * @param toY Coordinate y after last row
+     */
+    void compactRows(size_t fromY, size_t toY) {
+        toY = std::min(toY, sizeY);
+        if (fromY >= toY) {
+            return;
+        }
+
+        for (size_t y = fromY >> CHUNKEDMATRIXCHUNKBITS; y <= ((toY - 1) >> CHUNKEDMATRIXCHUNKBITS); y++) {
+            for (size_t x = 0; x < columnSlot.size(); x++) {
+                std::shared_ptr<Chunk> & chunk = chunks[columnSlot[x] + rowSlot[y]];
+                if (chunk.use_count() == 1 && isChunkUniform(x, y)) {
+                    chunk = uniformChunk(chunk->data[0]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get number of chunks not shared with uniform instance
+     *
+     * @return size_t
+     */
+    size_t getAllocatedChunks() const {
+        size_t allocated = 0;
+        for (size_t y = 0; y < rowSlot.size(); y++) {
+            for (size_t x = 0; x < columnSlot.size(); x++) {
+                const Chunk * chunk = chunks[columnSlot[x] + rowSlot[y]].get();
+                bool uniform = false;
+                for (auto & u : uniformChunks) {
+                    uniform = uniform || (u.get() == chunk);
+                }
+                allocated += uniform ? 0 : 1;
+            }
+        }
+        return allocated;
+    }
+};
+
+#endif /* CHUNKEDMATRIX_H */
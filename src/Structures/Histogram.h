@@ -0,0 +1,168 @@
+/****************************************************************
+ * @file Histogram.h
+ * @author Michal Dobes
+ * @brief Histogram with fixed logarithmic buckets
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#define HISTOGRAMSUBBUCKETBITS 3 //< Each power of two is split into 2^bits buckets
+
+/**
+ * @brief Histogram with fixed logarithmic buckets
+ *
+ * Counts values in buckets, small values have bucket each, larger values
+ * share buckets whose width is 1/8 of their power of two, so relative error
+ * of percentile is at most 12.5 %. Recording is a few instructions without
+ * any allocation. Maximal value is kept exactly.
+ *
+ */
+class Histogram {
+private:
+    static constexpr unsigned int subBuckets = 1 << HISTOGRAMSUBBUCKETBITS; //< Buckets in power of two
+    static constexpr unsigned int exactValues = 2 * subBuckets; //< Values with own bucket
+    static constexpr unsigned int exactBits = HISTOGRAMSUBBUCKETBITS + 1; //< Bits of exact values
+    static constexpr unsigned int bucketCount = exactValues + (64 - exactBits) * subBuckets;
+
+    std::array<uint64_t, bucketCount> buckets; //< Number of values in each bucket
+    uint64_t values; //< Number of recorded values
+    uint64_t total; //< Sum of recorded values
+    uint64_t maximum; //< Maximal recorded value
+
+    /**
+     * @brief Get bucket of value
+     *
+     * @param value value
+     * @return unsigned int index of bucket
+     */
+    static unsigned int bucketOf(uint64_t value) {
+        if (value < exactValues) {
+            return value;
+        }
+        unsigned int octave = 63 - __builtin_clzll(value);
+        unsigned int sub = (value >> (octave - HISTOGRAMSUBBUCKETBITS)) & (subBuckets - 1);
+        return exactValues + ((octave - exactBits) * subBuckets) + sub;
+    }
+
+    /**
+     * @brief Get the highest value in bucket
+     *
+     * @param bucket index of bucket
+     * @return uint64_t
+     */
+    static uint64_t bucketUpperBound(unsigned int bucket) {
+        if (bucket < exactValues) {
+            return bucket;
+        }
+        unsigned int octave = ((bucket - exactValues) / subBuckets) + exactBits;
+        uint64_t sub = (bucket - exactValues) % subBuckets;
+        uint64_t width = (uint64_t)1 << (octave - HISTOGRAMSUBBUCKETBITS);
+        return ((subBuckets + sub) * width) + (width - 1);
+    }
+
+public:
+    /**
+     * @brief Construct a new, empty Histogram object
+     *
+     */
+    Histogram() : values(0), total(0), maximum(0) {
+        buckets.fill(0);
+    }
+
+    /**
+     * @brief Record value
+     *
+     * @param value value
+     */
+    void record(uint64_t value) {
+        buckets[bucketOf(value)]++;
+        values++;
+        total += value;
+        maximum = std::max(maximum, value);
+    }
+
+    /**
+     * @brief Add all values of other histogram
+     *
+     * @param other histogram
+     */
+    void merge(const Histogram & other) {
+        for (unsigned int b = 0; b < bucketCount; b++) {
+            buckets[b] += other.buckets[b];
+        }
+        values += other.values;
+        total += other.total;
+        maximum = std::max(maximum, other.maximum);
+    }
+
+    /**
+     * @brief Remove all values
+     *
+     */
+    void clear() {
+        *this = Histogram();
+    }
+
+    /**
+     * @brief Get number of recorded values
+     *
+     * @return uint64_t
+     */
+    uint64_t getCount() const {
+        return values;
+    }
+
+    /**
+     * @brief Get sum of recorded values
+     *
+     * @return uint64_t
+     */
+    uint64_t getTotal() const {
+        return total;
+    }
+
+    /**
+     * @brief Get maximal recorded value
+     *
+     * @return uint64_t 0 if histogram is empty
+     */
+    uint64_t getMax() const {
+        return maximum;
+    }
+
+    /**
+     * @brief Get value below which is given percentage of recorded values
+     *
+     * Value is the highest value of bucket, but never more than maximal value.
+     *
+     * @param percent percentage from 0 to 100
+     * @return uint64_t 0 if histogram is empty
+     */
+    uint64_t getPercentile(double percent) const {
+        if (values == 0) {
+            return 0;
+        }
+
+        // Rank of value, the first value has rank 1
+        uint64_t rank = std::max<uint64_t>(1, (uint64_t)((percent / 100.0) * values + 0.5));
+        uint64_t counted = 0;
+        for (unsigned int b = 0; b < bucketCount; b++) {
+            counted += buckets[b];
+            if (counted >= rank) {
+                return std::min(bucketUpperBound(b), maximum);
+            }
+        }
+        return maximum;
+    }
+};
+
+#endif /* HISTOGRAM_H */
@@ -148,6 +148,20 @@ public:
     const T & at(size_t x, size_t y) const {
         return data[getIndexFor(x, y)];
     }
+
+    /**
+     * @brief Get pointer to first element of row
+     *
+     * Elements of row are stored lineary, row has getSizeX() elements.
+     *
+     * @exception std::out_of_range Row is not in range
+     *
+     * @param y Coordinate y of row
+     * @return const T* First element of row
+     */
+    const T * row(size_t y) const {
+        return data + getIndexFor(0, y);
+    }
 };
 
 #endif /* MATRIX_H */
\ No newline at end of file
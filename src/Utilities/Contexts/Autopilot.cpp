@@ -0,0 +1,208 @@
+#include <algorithm>
+
+#include "Utilities/Contexts/Autopilot.h"
+
+void Autopilot::prepareSearch(size_t tiles) {
+    if (playerStamp.size() != tiles) {
+        ghostStamp.assign(tiles, 0);
+        ghostDistance.assign(tiles, unreached);
+        preyStamp.assign(tiles, 0);
+        playerStamp.assign(tiles, 0);
+        playerDistance.assign(tiles, unreached);
+        firstStep.assign(tiles, Rotation());
+        queue.reserve(tiles);
+        stamp = 0;
+    }
+
+    stamp++;
+    if (stamp == 0) { //< Stamp overflowed, old stamps could match again
+        std::fill(ghostStamp.begin(), ghostStamp.end(), 0);
+        std::fill(preyStamp.begin(), preyStamp.end(), 0);
+        std::fill(playerStamp.begin(), playerStamp.end(), 0);
+        stamp = 1;
+    }
+}
+
+void Autopilot::searchDanger(const Game & game) {
+    const Board & board = *game.board;
+    size_t sizeX = board.getSizeX();
+
+    const Enemies & ghosts = game.ghosts;
+    queue.clear();
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        const Position & pos = ghosts.getPosition(i);
+        if (!ghosts.isAlive(i) || !board.isTileCoordinateValid(pos)) {
+            continue;
+        }
+
+        uint32_t index = (pos.y * sizeX) + pos.x;
+        if (ghosts.isFrightened(i)) {
+            preyStamp[index] = stamp;
+        } else if (ghostStamp[index] != stamp) {
+            ghostStamp[index] = stamp;
+            ghostDistance[index] = 0;
+            queue.push_back(index);
+        }
+    }
+
+    // Breadth first search from all dangerous ghosts at once
+    for (size_t head = 0; head < queue.size(); head++) {
+        uint32_t index = queue[head];
+        if (ghostDistance[index] >= AUTOPILOTDANGERRADIUS) {
+            continue;
+        }
+
+        Position pos(index % sizeX, index / sizeX);
+        for (size_t d = 0; d < 4; d++) {
+            Position next = board.neighbourPosition(pos, Rotation(d));
+            if (!board.isTileAllowingMovement(next)) {
+                continue;
+            }
+
+            uint32_t nextIndex = (next.y * sizeX) + next.x;
+            if (ghostStamp[nextIndex] != stamp) {
+                ghostStamp[nextIndex] = stamp;
+                ghostDistance[nextIndex] = ghostDistance[index] + 1;
+                queue.push_back(nextIndex);
+            }
+        }
+    }
+}
+
+uint32_t Autopilot::dangerAt(uint32_t index) const {
+    if (ghostStamp[index] != stamp) {
+        return unreached;
+    }
+    return ghostDistance[index];
+}
+
+bool Autopilot::isTarget(const Game & game, const Position & pos, uint32_t index) const {
+    return preyStamp[index] == stamp || Board::Tile::typeAllowsInteraction(game.board->tileAt(pos));
+}
+
+std::optional<Rotation> Autopilot::decide(const Game & game) {
+    const Board & board = *game.board;
+    size_t sizeX = board.getSizeX();
+    Position playerPos = game.player->getTransform().position;
+    if (!board.isTileCoordinateValid(playerPos)) {
+        return { };
+    }
+
+    prepareSearch(board.getSizeX() * board.getSizeY());
+    searchDanger(game);
+
+    // Breadth first search from player through safe tiles, tile is safe if player
+    // reaches it sooner than any ghost
+    uint32_t playerIndex = (playerPos.y * sizeX) + playerPos.x;
+    playerStamp[playerIndex] = stamp;
+    playerDistance[playerIndex] = 0;
+    queue.clear();
+    queue.push_back(playerIndex);
+
+    for (size_t head = 0; head < queue.size() && head < searchLimit; head++) {
+        uint32_t index = queue[head];
+        Position pos(index % sizeX, index / sizeX);
+
+        if (index != playerIndex && isTarget(game, pos, index)) {
+            return firstStep[index];
+        }
+
+        for (size_t d = 0; d < 4; d++) {
+            Position next = board.neighbourPosition(pos, Rotation(d));
+            if (!board.isTileAllowingMovement(next)) {
+                continue;
+            }
+
+            uint32_t nextIndex = (next.y * sizeX) + next.x;
+            uint32_t distance = playerDistance[index] + 1;
+            uint32_t danger = dangerAt(nextIndex);
+            if (playerStamp[nextIndex] == stamp || (danger != unreached && danger <= distance)) {
+                continue;
+            }
+
+            playerStamp[nextIndex] = stamp;
+            playerDistance[nextIndex] = distance;
+            firstStep[nextIndex] = (index == playerIndex) ? Rotation(d) : firstStep[index];
+            queue.push_back(nextIndex);
+        }
+    }
+
+    // No reachable target, flee to neighbouring tile farthest from ghosts
+    std::optional<Rotation> flee;
+    uint32_t fleeDanger = 0;
+    for (size_t d = 0; d < 4; d++) {
+        Position next = board.neighbourPosition(playerPos, Rotation(d));
+        if (!board.isTileAllowingMovement(next)) {
+            continue;
+        }
+
+        uint32_t danger = dangerAt((next.y * sizeX) + next.x);
+        if (!flee || danger > fleeDanger) {
+            flee = Rotation(d);
+            fleeDanger = danger;
+        }
+    }
+    return flee;
+}
+
+Autopilot::Autopilot(size_t maxSearchedTiles)
+    :
+    searchLimit(maxSearchedTiles),
+    stamp(0),
+    decisions(0),
+    lastDecisionTime(0.0),
+    maxDecisionTime(0.0),
+    totalDecisionTime(0.0) { }
+
+std::optional<Rotation> Autopilot::getPlayerRotation(const Game & game) {
+    if (!game.board || !game.player) {
+        return { };
+    }
+
+    // Decide again only if some entity moved or ghost changed mode since last decision
+    std::vector<Position> positions;
+    std::vector<int> ghostModes;
+    positions.reserve(game.ghosts.size() + 1);
+    ghostModes.reserve(game.ghosts.size());
+    positions.push_back(game.player->getTransform().position);
+    for (size_t i = 0; i < game.ghosts.size(); i++) {
+        positions.push_back(game.ghosts.getPosition(i));
+        ghostModes.push_back(!game.ghosts.isAlive(i) ? 0 : (game.ghosts.isFrightened(i) ? 1 : 2));
+    }
+    if (lastDecision && positions == lastPositions && ghostModes == lastGhostModes) {
+        return lastDecision;
+    }
+    lastPositions = std::move(positions);
+    lastGhostModes = std::move(ghostModes);
+
+    clock::time_point begin = clock::now();
+    lastDecision = decide(game);
+    lastDecisionTime = std::chrono::duration<double, std::micro>(clock::now() - begin).count();
+
+    decisions++;
+    totalDecisionTime += lastDecisionTime;
+    if (lastDecisionTime > maxDecisionTime) {
+        maxDecisionTime = lastDecisionTime;
+    }
+
+    return lastDecision;
+}
+
+unsigned long Autopilot::getDecisions() const {
+    return decisions;
+}
+
+double Autopilot::getLastDecisionTime() const {
+    return lastDecisionTime;
+}
+
+double Autopilot::getMaxDecisionTime() const {
+    return maxDecisionTime;
+}
+
+double Autopilot::getAverageDecisionTime() const {
+    if (decisions == 0) {
+        return 0.0;
+    }
+    return totalDecisionTime / decisions;
+}
@@ -0,0 +1,162 @@
+/****************************************************************
+ * @file Autopilot.h
+ * @author Michal Dobes
+ * @brief Autopilot control context
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+*****************************************************************/
+
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#define AUTOPILOTSEARCHLIMIT 4096 //< Default maximal amount of tiles searched in one decision
+#define AUTOPILOTDANGERRADIUS 6 //< Distance from ghosts in which tiles are dangerous
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "GameLogic/Game.h"
+#include "Structures/Transforms/Rotation.h"
+
+/**
+ * @brief Autopilot
+ *
+ * Chooses player's next rotation automatically, can be passed into Game in place
+ * of keyboard input (see GameControl).
+ *
+ * Player heads to the nearest (in maze distance) coin, bonus, frighten tile or
+ * frightened ghost, along path that avoids tiles ghosts can reach sooner than player.
+ * If no such path exists, player flees from ghosts.
+ *
+ * Decision is recalculated only when player or some ghost moved or some ghost
+ * was eaten or its frighten mode changed. Cost of decision
+ * is bounded by maximal amount of searched tiles and measured.
+ *
+ */
+class Autopilot {
+private:
+    typedef std::chrono::steady_clock clock;
+
+    static constexpr uint32_t unreached = std::numeric_limits<uint32_t>::max(); //< Distance of tile that wasn't reached
+
+    const size_t searchLimit; //< Maximal amount of tiles searched by player search
+
+    // Search buffers are reused between decisions, tiles are valid only if their
+    // stamp matches current stamp, so buffers don't need to be cleared
+    std::vector<uint32_t> ghostStamp; //< Stamps of tiles in ghost search
+    std::vector<uint32_t> ghostDistance; //< Distance of tile from the nearest dangerous ghost
+    std::vector<uint32_t> preyStamp; //< Stamps of tiles with frightened ghost
+    std::vector<uint32_t> playerStamp; //< Stamps of tiles in player search
+    std::vector<uint32_t> playerDistance; //< Distance of tile from player
+    std::vector<Rotation> firstStep; //< First step of player on path to tile
+    std::vector<uint32_t> queue; //< Queue of searches
+    uint32_t stamp; //< Current stamp
+
+    std::vector<Position> lastPositions; //< Positions of player and ghosts at last decision
+    std::vector<int> lastGhostModes; //< Modes of ghosts at last decision (0 dead,
+    // 1 frightened, 2 dangerous)
+    std::optional<Rotation> lastDecision; //< Last decision
+
+    unsigned long decisions; //< Amount of calculated decisions
+    double lastDecisionTime; //< Duration of last decision in microseconds
+    double maxDecisionTime; //< Maximal duration of decision in microseconds
+    double totalDecisionTime; //< Sum of durations of decisions in microseconds
+
+    /**
+     * @brief Prepare buffers for board and raise stamp
+     *
+     * @param tiles amount of tiles of board
+     */
+    void prepareSearch(size_t tiles);
+
+    /**
+     * @brief Calculate distances from dangerous (alive, not frightened) ghosts
+     *
+     * Only distances up to AUTOPILOTDANGERRADIUS are calculated. Also marks tiles
+     * with frightened ghosts for isTarget.
+     *
+     * @param game game
+     */
+    void searchDanger(const Game & game);
+
+    /**
+     * @brief Get distance of tile from the nearest dangerous ghost
+     *
+     * @param index index of tile
+     * @return uint32_t distance, unreached if tile is not near ghost
+     */
+    uint32_t dangerAt(uint32_t index) const;
+
+    /**
+     * @brief Is tile a target of player
+     *
+     * @param game game
+     * @param pos position of tile
+     * @param index index of tile
+     * @return true
+     * @return false
+     */
+    bool isTarget(const Game & game, const Position & pos, uint32_t index) const;
+
+    /**
+     * @brief Calculate next rotation of player
+     *
+     * @param game game
+     * @return std::optional<Rotation>
+     */
+    std::optional<Rotation> decide(const Game & game);
+
+public:
+    /**
+     * @brief Construct a new Autopilot object
+     *
+     * @param maxSearchedTiles maximal amount of tiles searched in one decision
+     */
+    Autopilot(size_t maxSearchedTiles = AUTOPILOTSEARCHLIMIT);
+
+    /**
+     * @brief Get player's next rotation in game
+     *
+     * Board needs to be loaded in game and game needs to be restarted before.
+     *
+     * @param game game in which player plays
+     * @return std::optional<Rotation> Empty if no rotation could be chosen, else
+     *      contains player's next rotation
+     */
+    std::optional<Rotation> getPlayerRotation(const Game & game);
+
+    /**
+     * @brief Get amount of calculated decisions
+     *
+     * @return unsigned long
+     */
+    unsigned long getDecisions() const;
+
+    /**
+     * @brief Get duration of last decision
+     *
+     * @return double microseconds
+     */
+    double getLastDecisionTime() const;
+
+    /**
+     * @brief Get maximal duration of decision
+     *
+     * @return double microseconds
+     */
+    double getMaxDecisionTime() const;
+
+    /**
+     * @brief Get average duration of decision
+     *
+     * @return double microseconds
+     */
+    double getAverageDecisionTime() const;
+};
+
+#endif /* AUTOPILOT_H */
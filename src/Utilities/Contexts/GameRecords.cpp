@@ -1,18 +1,200 @@
+#include <algorithm>
+#include <tuple>
+
 #include "Utilities/Contexts/GameRecords.h"
 
 GameRecords::GameRecords() { }
 
 GameRecords::~GameRecords() { }
 
+uint64_t GameRecords::leaderboardKey(uint32_t mapId, unsigned int difficulty) {
+    return ((uint64_t)mapId << 32) | (uint32_t)difficulty;
+}
+
+const GameRecords::Leaderboard * GameRecords::findLeaderboard(const std::string & map, unsigned int difficulty) const {
+    auto id = mapIds.find(map);
+    if (id == mapIds.end()) {
+        return nullptr;
+    }
+
+    auto leaderboard = leaderboards.find(leaderboardKey(id->second, difficulty));
+    if (leaderboard == leaderboards.end()) {
+        return nullptr;
+    }
+
+    return &leaderboard->second;
+}
+
+size_t GameRecords::subtreeRuns(const Leaderboard & leaderboard, size_t node) {
+    return (node == none) ? 0 : leaderboard.nodes[node].subtreeRuns;
+}
+
+size_t GameRecords::rotate(Leaderboard & leaderboard, size_t node, bool toRight) {
+    Node & parent = leaderboard.nodes[node];
+    size_t childIndex = toRight ? parent.left : parent.right;
+    Node & child = leaderboard.nodes[childIndex];
+
+    if (toRight) {
+        parent.left = child.right;
+        child.right = node;
+    } else {
+        parent.right = child.left;
+        child.left = node;
+    }
+
+    parent.subtreeRuns = parent.runs + subtreeRuns(leaderboard, parent.left) + subtreeRuns(leaderboard, parent.right);
+    child.subtreeRuns = child.runs + subtreeRuns(leaderboard, child.left) + subtreeRuns(leaderboard, child.right);
+    return childIndex;
+}
+
+size_t GameRecords::insert(Leaderboard & leaderboard, size_t node, unsigned long score, size_t runs) {
+    if (node == none) {
+        // Priority is hash of score (splitmix64), so tree shape doesn't depend on order of runs
+        uint64_t priority = score + 0x9e3779b97f4a7c15;
+        priority = (priority ^ (priority >> 30)) * 0xbf58476d1ce4e5b9;
+        priority = (priority ^ (priority >> 27)) * 0x94d049bb133111eb;
+        priority ^= priority >> 31;
+
+        leaderboard.nodes.push_back(Node { score, runs, runs, priority });
+        return leaderboard.nodes.size() - 1;
+    }
+
+    leaderboard.nodes[node].subtreeRuns += runs;
+    unsigned long nodeScore = leaderboard.nodes[node].score;
+    if (score == nodeScore) {
+        leaderboard.nodes[node].runs += runs;
+        return node;
+    }
+
+    // Insert into subtree and restore heap order of priorities on the way up
+    bool toLeft = score < nodeScore;
+    size_t child = insert(leaderboard, toLeft ? leaderboard.nodes[node].left : leaderboard.nodes[node].right, score, runs);
+    (toLeft ? leaderboard.nodes[node].left : leaderboard.nodes[node].right) = child;
+
+    if (leaderboard.nodes[child].priority > leaderboard.nodes[node].priority) {
+        return rotate(leaderboard, node, toLeft);
+    }
+    return node;
+}
+
+bool GameRecords::addScore(const std::string & map, unsigned int difficulty, unsigned long score, size_t runs) {
+    if (runs == 0) {
+        return false;
+    }
+
+    auto id = mapIds.find(map);
+    if (id == mapIds.end()) {
+        id = mapIds.emplace(map, mapNames.size()).first;
+        mapNames.push_back(map);
+    }
 
-bool GameRecords::addScore(const std::string & map, unsigned int difficulty, unsigned long score) {
-    std::pair<std::string, unsigned int> key(map, difficulty);
+    Leaderboard & leaderboard = leaderboards[leaderboardKey(id->second, difficulty)];
+    leaderboard.root = insert(leaderboard, leaderboard.root, score, runs);
+    leaderboard.runs += runs;
 
-    if (records[key] >= score) {
+    if (leaderboard.best >= score) {
         return false;
     }
 
-    records[key] = score;
+    leaderboard.best = score;
 
     return true;
-}
\ No newline at end of file
+}
+
+unsigned long GameRecords::getBestScore(const std::string & map, unsigned int difficulty) const {
+    const Leaderboard * leaderboard = findLeaderboard(map, difficulty);
+    return (leaderboard == nullptr) ? 0 : leaderboard->best;
+}
+
+size_t GameRecords::getRuns(const std::string & map, unsigned int difficulty) const {
+    const Leaderboard * leaderboard = findLeaderboard(map, difficulty);
+    return (leaderboard == nullptr) ? 0 : leaderboard->runs;
+}
+
+std::vector<unsigned long> GameRecords::getTopScores(const std::string & map, unsigned int difficulty, size_t count) const {
+    std::vector<unsigned long> top;
+    const Leaderboard * leaderboard = findLeaderboard(map, difficulty);
+    if (leaderboard == nullptr) {
+        return top;
+    }
+
+    // Traverse tree from the highest score until enough scores are collected
+    std::vector<size_t> path;
+    size_t node = leaderboard->root;
+    while ((node != none || !path.empty()) && top.size() < count) {
+        if (node != none) {
+            path.push_back(node);
+            node = leaderboard->nodes[node].right;
+            continue;
+        }
+
+        const Node & highest = leaderboard->nodes[path.back()];
+        path.pop_back();
+        top.insert(top.end(), std::min(highest.runs, count - top.size()), highest.score);
+        node = highest.left;
+    }
+    return top;
+}
+
+GameRecords::Rank GameRecords::getRank(const std::string & map, unsigned int difficulty, unsigned long score) const {
+    const Leaderboard * leaderboard = findLeaderboard(map, difficulty);
+    if (leaderboard == nullptr || leaderboard->runs == 0) {
+        return Rank { 1, 0, 100.0 };
+    }
+
+    // Sum runs of scores not higher along the search path of score
+    size_t runsNotHigher = 0;
+    size_t node = leaderboard->root;
+    while (node != none) {
+        const Node & current = leaderboard->nodes[node];
+        if (current.score <= score) {
+            runsNotHigher += current.runs + subtreeRuns(*leaderboard, current.left);
+            node = current.right;
+        } else {
+            node = current.left;
+        }
+    }
+
+    return Rank {
+        leaderboard->runs - runsNotHigher + 1,
+        leaderboard->runs,
+        (100.0 * runsNotHigher) / leaderboard->runs };
+}
+
+std::vector<GameRecords::Record> GameRecords::getRecords() const {
+    std::vector<Record> records;
+    for (auto & l : leaderboards) {
+        const std::string & map = mapNames[l.first >> 32];
+        unsigned int difficulty = (uint32_t)l.first;
+        for (auto & n : l.second.nodes) {
+            records.push_back(Record { map, difficulty, n.score, n.runs });
+        }
+    }
+
+    std::sort(records.begin(), records.end(), [ ](const Record & a, const Record & b) {
+        return std::tie(a.map, a.difficulty, b.score) < std::tie(b.map, b.difficulty, a.score);
+        });
+    return records;
+}
+
+std::vector<GameRecords::Record> GameRecords::getBestRecords() const {
+    std::vector<Record> records;
+    for (auto & l : leaderboards) {
+        if (l.second.runs > 0) {
+            records.push_back(Record { mapNames[l.first >> 32], (uint32_t)l.first, l.second.best, 1 });
+        }
+    }
+
+    std::sort(records.begin(), records.end(), [ ](const Record & a, const Record & b) {
+        return std::tie(a.map, a.difficulty) < std::tie(b.map, b.difficulty);
+        });
+    return records;
+}
+
+size_t GameRecords::getDistinctScores() const {
+    size_t distinct = 0;
+    for (auto & l : leaderboards) {
+        distinct += l.second.nodes.size();
+    }
+    return distinct;
+}
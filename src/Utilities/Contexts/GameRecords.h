@@ -11,21 +11,128 @@
 #ifndef GAMERECORDS_H
 #define GAMERECORDS_H
 
-#include <map>
+#include <cstdint>
+#include <limits>
 #include <string>
-#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @brief Game records
  *
- * Stores previous records for board, manages getiing, adding new record or
- * overwriting previous one
+ * Stores scores of all runs for each map and difficulty (leaderboard), manages
+ * adding new runs and querying best scores and rank of score.
+ *
+ * Map names are interned, leaderboards are found by hash of map id and difficulty.
+ * Leaderboard keeps distinct scores in a balanced search tree (treap) whose nodes
+ * also count runs of their subtree, so both adding a run and finding rank of
+ * score take logarithmic time.
  *
  */
-struct GameRecords {
-    std::map<std::pair<std::string, unsigned int>, unsigned long> records; //< Map of records
-    // key is pair of map file name and difficulty, value is max score reached
+class GameRecords {
+public:
+    /**
+     * @brief Runs with one score
+     *
+     */
+    struct Record {
+        std::string map; //< Map file name
+        unsigned int difficulty; //< Difficulty of game
+        unsigned long score; //< Reached score
+        size_t runs; //< Number of runs that reached the score
+    };
+
+    /**
+     * @brief Position of score in leaderboard
+     *
+     */
+    struct Rank {
+        size_t rank; //< 1 + number of runs with higher score
+        size_t runs; //< Number of runs in leaderboard
+        double percentile; //< Percentage of runs with score not higher
+    };
+
+private:
+    static constexpr size_t none = std::numeric_limits<size_t>::max(); //< Index of missing node
+
+    /**
+     * @brief Distinct score in leaderboard tree
+     *
+     */
+    struct Node {
+        unsigned long score; //< Score
+        size_t runs; //< Number of runs that reached the score
+        size_t subtreeRuns; //< Number of runs in subtree of node
+        uint64_t priority; //< Heap priority of node, derived from score
+        size_t left = none; //< Index of subtree with lower scores
+        size_t right = none; //< Index of subtree with higher scores
+    };
+
+    /**
+     * @brief Scores of runs with one map and difficulty
+     *
+     */
+    struct Leaderboard {
+        std::vector<Node> nodes; //< Nodes of tree, one for each distinct score
+        size_t root = none; //< Index of root node
+        unsigned long best = 0; //< Highest score
+        size_t runs = 0; //< Number of runs
+    };
+
+    std::vector<std::string> mapNames; //< Interned map names, indexed by map id
+    std::unordered_map<std::string, uint32_t> mapIds; //< Map id of each map name
+    std::unordered_map<uint64_t, Leaderboard> leaderboards; //< Leaderboard
+    // for each key of map id and difficulty
+
+    /**
+     * @brief Get key of leaderboard
+     *
+     * @param mapId id of map
+     * @param difficulty difficulty of game
+     * @return uint64_t
+     */
+    static uint64_t leaderboardKey(uint32_t mapId, unsigned int difficulty);
+
+    /**
+     * @brief Find leaderboard
+     *
+     * @param map map file name
+     * @param difficulty difficulty of game
+     * @return const Leaderboard* leaderboard, nullptr if no run was recorded
+     */
+    const Leaderboard * findLeaderboard(const std::string & map, unsigned int difficulty) const;
+
+    /**
+     * @brief Get number of runs in subtree
+     *
+     * @param leaderboard leaderboard
+     * @param node index of subtree root, can be none
+     * @return size_t
+     */
+    static size_t subtreeRuns(const Leaderboard & leaderboard, size_t node);
+
+    /**
+     * @brief Rotate subtree so that child of its root becomes the root
+     *
+     * @param leaderboard leaderboard
+     * @param node index of subtree root
+     * @param toRight true left child becomes the root, false right child becomes the root
+     * @return size_t index of new subtree root
+     */
+    static size_t rotate(Leaderboard & leaderboard, size_t node, bool toRight);
+
+    /**
+     * @brief Add runs with score into subtree
+     *
+     * @param leaderboard leaderboard
+     * @param node index of subtree root, can be none
+     * @param score reached score
+     * @param runs number of runs
+     * @return size_t index of new subtree root
+     */
+    static size_t insert(Leaderboard & leaderboard, size_t node, unsigned long score, size_t runs);
 
+public:
     /**
      * @brief Construct a new Game Records object
      *
@@ -39,16 +146,77 @@ struct GameRecords {
     ~GameRecords();
 
     /**
-     * @brief Try to add score as record
+     * @brief Record score of runs
      *
      * @param map map file name
      * @param difficulty difficulty of game
      * @param score reached score
-     * @return true reached score is a new record and was stored
-     * @return false reached score is not record and was discarded
+     * @param runs number of runs that reached the score
+     * @return true reached score is a new record
+     * @return false reached score is not higher than previous record
+     */
+    bool addScore(const std::string & map, unsigned int difficulty, unsigned long score, size_t runs = 1);
+
+    /**
+     * @brief Get highest score
+     *
+     * @param map map file name
+     * @param difficulty difficulty of game
+     * @return unsigned long highest score, 0 if no run was recorded
+     */
+    unsigned long getBestScore(const std::string & map, unsigned int difficulty) const;
+
+    /**
+     * @brief Get number of recorded runs
+     *
+     * @param map map file name
+     * @param difficulty difficulty of game
+     * @return size_t
      */
-    bool addScore(const std::string & map, unsigned int difficulty, unsigned long score);
+    size_t getRuns(const std::string & map, unsigned int difficulty) const;
 
+    /**
+     * @brief Get highest scores
+     *
+     * @param map map file name
+     * @param difficulty difficulty of game
+     * @param count maximal number of scores
+     * @return std::vector<unsigned long> scores of best runs, descending
+     */
+    std::vector<unsigned long> getTopScores(const std::string & map, unsigned int difficulty, size_t count) const;
+
+    /**
+     * @brief Get rank of score among recorded runs
+     *
+     * Score doesn't need to be recorded, rank is where it would be placed.
+     *
+     * @param map map file name
+     * @param difficulty difficulty of game
+     * @param score score
+     * @return Rank rank 1 and percentile 100 if no run was recorded
+     */
+    Rank getRank(const std::string & map, unsigned int difficulty, unsigned long score) const;
+
+    /**
+     * @brief Get all distinct scores
+     *
+     * @return std::vector<Record> records sorted by map, difficulty and descending score
+     */
+    std::vector<Record> getRecords() const;
+
+    /**
+     * @brief Get highest score of each map and difficulty
+     *
+     * @return std::vector<Record> records sorted by map and difficulty, runs are 1
+     */
+    std::vector<Record> getBestRecords() const;
+
+    /**
+     * @brief Get number of distinct scores of all maps and difficulties
+     *
+     * @return size_t
+     */
+    size_t getDistinctScores() const;
 };
 
-#endif /* GAMESETTINGS_H */
\ No newline at end of file
+#endif /* GAMERECORDS_H */
@@ -8,7 +8,8 @@ GameSettings::GameSettings() :
     frightenDuration(0),
     killDuration(0),
     bonusPeriod(0),
-    ghostComeOutPeriod(0) { }
+    ghostComeOutPeriod(0),
+    ghostSearchBudget(DEFAULTGHOSTSEARCHBUDGET) { }
 
 GameSettings::GameSettings(
     unsigned int playerSpd,
@@ -27,6 +28,7 @@ GameSettings::GameSettings(
     frightenDuration(frightenDur),
     killDuration(killDur),
     bonusPeriod(bonusPer),
-    ghostComeOutPeriod(ghostComeOutPer) { }
+    ghostComeOutPeriod(ghostComeOutPer),
+    ghostSearchBudget(DEFAULTGHOSTSEARCHBUDGET) { }
 
 GameSettings::~GameSettings() { }
\ No newline at end of file
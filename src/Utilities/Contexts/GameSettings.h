@@ -11,6 +11,12 @@
 #ifndef GAMESETTINGS_H
 #define GAMESETTINGS_H
 
+#define DEFAULTGHOSTSEARCHBUDGET 20
+#define GAMEMAXGHOSTS 8192 //< Maximal amount of ghosts in roster
+
+#include <string>
+#include <vector>
+
 /**
  * @brief Game settings
  *
@@ -18,6 +24,18 @@
  *
  */
 struct GameSettings {
+    /**
+     * @brief Group of ghosts of the same type in roster
+     *
+     */
+    struct GhostGroup {
+        std::string type; //< Name of type of ghosts (see Enemies::typeFromName)
+        unsigned int count; //< Amount of ghosts
+        int scatterX; //< Scatter target x coordinate, negative counts from right edge of board
+        int scatterY; //< Scatter target y coordinate, negative counts from bottom edge of board
+        unsigned int release; //< Milliseconds after restart when ghosts come out
+    };
+
     unsigned int playerSpeed;
     unsigned int enemySpeed;
 
@@ -29,6 +47,12 @@ struct GameSettings {
     unsigned int bonusPeriod;
     unsigned int ghostComeOutPeriod;
 
+    unsigned int ghostSearchBudget; //< Optional, milliseconds for planning of ghosts
+    // with highest intelligence
+
+    std::vector<GhostGroup> ghostRoster; //< Optional, ghosts in game, if empty
+    // the four original ghosts are used
+
     /**
      * @brief Construct a new, nulled Game Settings object
      *
@@ -38,6 +62,8 @@ struct GameSettings {
     /**
      * @brief Construct a new Game Settings object with parameters
      *
+     * Optional settings are set to default values.
+     *
      * @param playerSpd
      * @param enemySpd
      * @param scatterDur
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <unistd.h>
+
+#include "Utilities/Contexts/MapIndex.h"
+#include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/FileManagers/MapIndexFileLoader.h"
+#include "Utilities/FileManagers/MapIndexFileSaver.h"
+#include "Utilities/ThreadPool.h"
+
+void MapIndex::describe(Entry & entry) const {
+    std::string path = (std::filesystem::path(directoryPath) / entry.name).string();
+
+    entry.sizeX = 0;
+    entry.sizeY = 0;
+    entry.coins = 0;
+    entry.valid = false;
+
+    try {
+        BoardFileLoader loader(path);
+        Board board = loader.loadBoard();
+        entry.sizeX = board.getSizeX();
+        entry.sizeY = board.getSizeY();
+        entry.coins = board.getNumberOfCoins();
+        entry.valid = true;
+    }
+    catch (std::exception & e) { } //< Map that can't be loaded for any reason is only
+    // marked invalid, so it doesn't stop describing of other maps
+}
+
+MapIndex::MapIndex(const std::string & directory) : directoryPath(directory) { }
+
+size_t MapIndex::update(const std::vector<std::string> & extensions, size_t threads) {
+    // Load entries from index file, missing or broken index is rebuilt
+    std::unordered_map<std::string, Entry> indexed;
+    try {
+        MapIndexFileLoader loader(getIndexPath());
+        for (auto & e : loader.loadEntries()) {
+            indexed[e.name] = e;
+        }
+    }
+    catch (FileLoaderException & e) { }
+
+    // List files, only their metadata are read
+    std::vector<Entry> listed;
+    std::vector<size_t> stale;
+    for (const auto & file : std::filesystem::directory_iterator(directoryPath)) {
+        if (!file.is_regular_file()
+            || std::find(extensions.begin(), extensions.end(), file.path().extension()) == extensions.end()) {
+            continue;
+        }
+
+        Entry entry;
+        entry.name = file.path().filename().string();
+        entry.modified = file.last_write_time().time_since_epoch().count();
+        entry.fileSize = file.file_size();
+
+        auto found = indexed.find(entry.name);
+        if (found != indexed.end()
+            && found->second.modified == entry.modified
+            && found->second.fileSize == entry.fileSize) {
+            entry = found->second;
+        } else {
+            stale.push_back(listed.size());
+        }
+        listed.push_back(entry);
+    }
+
+    // Describe new and changed files in parallel
+    if (!stale.empty()) {
+        ThreadPool pool(std::min(threads == 0 ? (size_t) std::thread::hardware_concurrency() : threads, stale.size()));
+        std::vector<std::future<void>> described;
+        for (size_t i : stale) {
+            described.push_back(pool.submit([ this, &listed, i ]() {
+                describe(listed[i]);
+                }));
+        }
+        for (auto & d : described) {
+            d.get();
+        }
+    }
+
+    std::sort(listed.begin(), listed.end(), [ ](const Entry & a, const Entry & b) {
+        return a.name < b.name;
+        });
+
+    bool changed = !stale.empty() || listed.size() != indexed.size();
+    entries = std::move(listed);
+
+    if (changed) {
+        // Index is written to temporary file (unique for process, so processes refreshing
+        // the same index don't write into the same file) first, so it is never left half written
+        std::string temporaryPath = getIndexPath() + "." + std::to_string(getpid()) + ".tmp";
+        bool written = false;
+        try {
+            {
+                MapIndexFileSaver saver(temporaryPath);
+                saver.writeEntries(entries);
+            }
+            std::filesystem::rename(temporaryPath, getIndexPath());
+            written = true;
+        }
+        catch (FileLoaderException & e) { } //< Index is only cache, it is rebuilt next time
+        catch (std::filesystem::filesystem_error & e) { }
+
+        if (!written) {
+            std::error_code error;
+            std::filesystem::remove(temporaryPath, error);
+        }
+    }
+
+    return stale.size();
+}
+
+const std::vector<MapIndex::Entry> & MapIndex::getEntries() const {
+    return entries;
+}
+
+std::string MapIndex::getIndexPath() const {
+    return (std::filesystem::path(directoryPath) / MAPINDEXFILENAME).string();
+}
@@ -0,0 +1,92 @@
+/****************************************************************
+ * @file MapIndex.h
+ * @author Michal Dobes
+ * @brief Index of map files
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPINDEX_H
+#define MAPINDEX_H
+
+#include <string>
+#include <vector>
+
+#define MAPINDEXFILENAME ".mapindex" //< Name of index file in directory of maps
+
+/**
+ * @brief Index of map files
+ *
+ * Stores metadata of map files in directory, so they don't need to be loaded to be
+ * described. Index is persisted in index file in the directory and updated
+ * incrementally, only maps which are new or whose modification time or size
+ * changed are loaded again (in parallel).
+ *
+ */
+class MapIndex {
+public:
+    /**
+     * @brief Metadata of map file
+     *
+     */
+    struct Entry {
+        std::string name; //< Name of file in directory
+        long long modified; //< Modification time of file (in ticks of filesystem clock)
+        unsigned long long fileSize; //< Size of file in bytes
+        size_t sizeX; //< Size of map in x dimension
+        size_t sizeY; //< Size of map in y dimension
+        unsigned int coins; //< Number of coins in map
+        bool valid; //< Map can be loaded
+    };
+
+private:
+    std::string directoryPath; //< Path to directory with maps
+    std::vector<Entry> entries; //< Entries sorted by name
+
+    /**
+     * @brief Load map file and describe it
+     *
+     * @param entry entry with name, modification time and size of file to fill
+     */
+    void describe(Entry & entry) const;
+
+public:
+    /**
+     * @brief Construct a new, empty Map Index object
+     *
+     * @param directory path to directory with maps
+     */
+    MapIndex(const std::string & directory);
+
+    /**
+     * @brief Update index by files in directory
+     *
+     * Loads index file, describes new and changed files with extension on thread
+     * pool and saves index file, if anything changed.
+     *
+     * @throw std::filesystem::filesystem_error directory couldn't be read
+     *
+     * @param extensions extensions of map files
+     * @param threads number of threads, if 0 number of hardware threads is used
+     * @return size_t number of files that were described again
+     */
+    size_t update(const std::vector<std::string> & extensions, size_t threads = 0);
+
+    /**
+     * @brief Get entries sorted by name of file
+     *
+     * @return const std::vector<Entry>&
+     */
+    const std::vector<Entry> & getEntries() const;
+
+    /**
+     * @brief Get path to index file
+     *
+     * @return std::string
+     */
+    std::string getIndexPath() const;
+};
+
+#endif /* MAPINDEX_H */
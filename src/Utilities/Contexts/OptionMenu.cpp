@@ -6,8 +6,9 @@ OptionMenu::OptionMenu() : needsRefresh(true), currentOption(0) { }
 
 OptionMenu::~OptionMenu() { }
 
-void OptionMenu::addOption(const std::string & name) {
+void OptionMenu::addOption(const std::string & name, const std::string & detail) {
     options.push_back(name);
+    details.push_back(detail);
 }
 
 void OptionMenu::changeSelection(bool up) {
@@ -26,6 +27,10 @@ std::string OptionMenu::getCurrentOptionName() const {
     return options[currentOption];
 }
 
+std::string OptionMenu::getCurrentOptionDetail() const {
+    return details[currentOption];
+}
+
 
 std::optional<unsigned int> OptionMenu::handleInput(int c) {
     needsRefresh = false;
@@ -29,6 +29,7 @@ class OptionMenu {
 private:
     bool needsRefresh; //< Indicator if values that can be displayed have changed
     std::vector<std::string> options; //< Option names
+    std::vector<std::string> details; //< Details of options, shown for current selection
     unsigned int currentOption; //< Current selected option
 
 public:
@@ -49,8 +50,9 @@ public:
      * @brief Add new option
      *
      * @param name Name of option
+     * @param detail Detail of option, shown when option is selected
      */
-    void addOption(const std::string & name);
+    void addOption(const std::string & name, const std::string & detail = "");
 
     /**
      * @brief Change current selection by one
@@ -75,6 +77,13 @@ public:
      */
     std::string getCurrentOptionName() const;
 
+    /**
+     * @brief Get detail of current selection
+     *
+     * @return std::string
+     */
+    std::string getCurrentOptionDetail() const;
+
     /**
      * @brief Handle input from keyboard
      *
@@ -1,8 +1,24 @@
+#include <algorithm>
+
 #include "Utilities/FileManagers/BoardFileLoader.h"
 
+bool BoardFileLoader::readByte(char & c) {
+    if (blockPosition == blockLength) {
+        file.read(block.data(), block.size());
+        blockLength = file.gcount();
+        blockPosition = 0;
+        if (blockLength == 0) {
+            return false;
+        }
+    }
+
+    c = block[blockPosition++];
+    return true;
+}
+
 bool BoardFileLoader::checkForSpecialCharacter(char c, size_t x, size_t y) {
     switch (c) { // If chars are 'P' or 'E', set spawn positions (or throw is spawn has already been set)
-        case 'P':
+        case playerSpawnChar:
             if (playerSpawn.x == -1 && playerSpawn.y == -1) {
                 playerSpawn = Position(x, y);
                 return true;
@@ -10,7 +26,7 @@ bool BoardFileLoader::checkForSpecialCharacter(char c, size_t x, size_t y) {
                 throw FileLoaderException("BoardFileLoader: checkForSpecialCharacter - duplicit player spawn");
             }
             return true;
-        case 'E':
+        case enemySpawnChar:
             if (enemySpawn.x == -1 && enemySpawn.y == -1) {
                 enemySpawn = Position(x, y);
             } else {
@@ -23,100 +39,210 @@ bool BoardFileLoader::checkForSpecialCharacter(char c, size_t x, size_t y) {
     return false;
 }
 
-BoardFileLoader::TileMatrix BoardFileLoader::createTilesOutOfData(std::list<std::string> & lines) {
-    BoardFileLoader::TileMatrix generatedTiles(lines.front().size(), lines.size());
+void BoardFileLoader::placeTile(TileMatrix & tiles, char c, size_t x, size_t y) {
+    // If char is special, replace it by default, else convert it to correct type
+    Board::Tile::Type type = checkForSpecialCharacter(c, x, y) ? Board::Tile::defaultType() : dataCharToType(c);
+    tiles.set(x, y, type);
+
+    // Check for correct teleport placement
+    bool movement = Board::Tile::typeAllowsMovement(type);
+    if (y == 0) {
+        firstRowMovement[x] = movement;
+    }
+    if (y == tiles.getSizeY() - 1 && firstRowMovement[x] != movement) {
+        throw FileLoaderException("BoardFileLoader: placeTile - wrong teleport");
+    }
+    if (x == 0) {
+        rowStartMovement = movement;
+    }
+    if (x == tiles.getSizeX() - 1 && rowStartMovement != movement) {
+        throw FileLoaderException("BoardFileLoader: placeTile - wrong teleport");
+    }
+}
+
+void BoardFileLoader::finishRows(TileMatrix & tiles, size_t y) {
+    // Rows of chunks are finished, chunks which are only space can be shared
+    if (y % TileMatrix::chunkSide == 0) {
+        tiles.compactRows(y - TileMatrix::chunkSide, y);
+    } else if (y == tiles.getSizeY()) {
+        tiles.compactRows(y - (y % TileMatrix::chunkSide), y);
+    }
+}
+
+void BoardFileLoader::measureGrid(size_t & sizeX, size_t & sizeY) {
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    if (fileSize < 0) {
+        throw FileLoaderException("BoardFileLoader: measureGrid - file can't be measured");
+    }
+    if (fileSize == 0) {
+        throw FileLoaderException("BoardFileLoader: loadBoard - empty grid");
+    }
+    file.seekg(0);
+
+    // Read blocks until end of the first line
+    sizeX = 0;
+    while (file.read(block.data(), block.size()) || file.gcount() > 0) {
+        const char * begin = block.data();
+        const char * end = begin + file.gcount();
+        const char * newline = std::find(begin, end, '\n');
+        sizeX += newline - begin;
+        if (newline != end) {
+            break;
+        }
+    }
+
+    file.clear();
+    file.seekg(0);
+    blockPosition = blockLength = 0;
+
+    if (sizeX == 0) {
+        throw FileLoaderException("BoardFileLoader: loadBoard - wrong format of grid in file");
+    }
+
+    // Each line takes its length and newline, except the last newline is optional
+    sizeY = (fileSize + 1) / (sizeX + 1);
+}
+
+BoardFileLoader::TileMatrix BoardFileLoader::readTextTiles(size_t sizeX, size_t sizeY) {
+    BoardFileLoader::TileMatrix generatedTiles(sizeX, sizeY, Board::Tile::Type::wall);
 
-    size_t y = 0;
     size_t x = 0;
-    for (auto & l : lines) {
-        for (auto & c : l) {
-            // For each character in each line, check if is special then replace 
-            // it by default, else convert it to correct type
-            if (checkForSpecialCharacter(c, x, y)) {
-                generatedTiles.at(x++, y) = Board::Tile::defaultType();
-            } else {
-                generatedTiles.at(x++, y) = dataCharToType(c);
+    size_t y = 0;
+    char c;
+    while (readByte(c)) {
+        if (c == '\n') {
+            if (x != sizeX) {
+                throw FileLoaderException("BoardFileLoader: loadBoard - wrong format of grid in file");
             }
+            x = 0;
+            finishRows(generatedTiles, ++y);
+            continue;
         }
-        x = 0;
-        y++;
-    }
 
-    if ((enemySpawn.x == -1 || enemySpawn.y == -1)
-        || (playerSpawn.x == -1 || playerSpawn.y == -1)) { //Check if spawns have been set
-        throw FileLoaderException("BoardFileLoader: createTilesOutOfData - missing spawn point");
+        if (x >= sizeX || y >= sizeY) {
+            throw FileLoaderException("BoardFileLoader: loadBoard - wrong format of grid in file");
+        }
+        placeTile(generatedTiles, c, x++, y);
     }
 
-    // Check if has minimal size
-    if (generatedTiles.getSizeX() <= 2 || generatedTiles.getSizeY() <= 2) {
-        throw FileLoaderException("BoardFileLoader: createTilesOutOfData - too small");
+    if (x == sizeX) { //< Last line without newline
+        x = 0;
+        finishRows(generatedTiles, ++y);
+    }
+    if (x != 0 || y != sizeY) {
+        throw FileLoaderException("BoardFileLoader: loadBoard - wrong format of grid in file");
     }
 
-    // Check for correct teleport placement
-    for (size_t y = 0; y < generatedTiles.getSizeY(); y++) {
-        if (Board::Tile::typeAllowsMovement(generatedTiles.at(0, y))
-            != Board::Tile::typeAllowsMovement(generatedTiles.at(generatedTiles.getSizeX() - 1, y))) {
-            throw FileLoaderException("BoardFileLoader: createTilesOutOfData - wrong teleport");
+    return generatedTiles;
+}
+
+bool BoardFileLoader::readBinaryHeader(size_t & sizeX, size_t & sizeY) {
+    char c;
+    for (char m : binaryMagic) {
+        if (!readByte(c) || c != m) {
+            // Not binary, text is read from beginning
+            file.clear();
+            file.seekg(0);
+            blockPosition = blockLength = 0;
+            return false;
         }
     }
 
-    for (size_t x = 0; x < generatedTiles.getSizeX(); x++) {
-        if (Board::Tile::typeAllowsMovement(generatedTiles.at(x, 0))
-            != Board::Tile::typeAllowsMovement(generatedTiles.at(x, generatedTiles.getSizeY() - 1))) {
-            throw FileLoaderException("BoardFileLoader: createTilesOutOfData - wrong teleport");
+    if (!readByte(c) || (unsigned char) c != binaryVersion) {
+        throw FileLoaderException("BoardFileLoader: readBinaryHeader - unknown version");
+    }
+
+    size_t * sizes[2] = { &sizeX, &sizeY };
+    for (auto size : sizes) {
+        *size = 0;
+        for (size_t i = 0; i < 4; i++) {
+            if (!readByte(c)) {
+                throw FileLoaderException("BoardFileLoader: readBinaryHeader - wrong format of header");
+            }
+            *size |= (size_t) (unsigned char) c << (8 * i);
         }
     }
 
-    return generatedTiles;
+    return true;
 }
 
-Board::Tile::Type BoardFileLoader::dataCharToType(char c) {
-    switch (c) { // Map chars to types
-        case '#':
-            return Board::Tile::Type::wall;
-            break;
-        case '.':
-            return Board::Tile::Type::coin;
-        case 'o':
-            return Board::Tile::Type::frighten;
-        case ' ':
-            break;
-        default:
-            throw FileLoaderException("BoardFileLoader: dataCharToType - unknown char in file");
-            break;
+BoardFileLoader::TileMatrix BoardFileLoader::readBinaryTiles(size_t sizeX, size_t sizeY) {
+    BoardFileLoader::TileMatrix generatedTiles(sizeX, sizeY, Board::Tile::Type::wall);
+
+    size_t x = 0;
+    size_t y = 0;
+    char c;
+    while (readByte(c)) {
+        size_t index = (unsigned char) c >> 5;
+        if (index >= binaryTileChars.size()) {
+            throw FileLoaderException("BoardFileLoader: readBinaryTiles - unknown tile");
+        }
+        char tile = binaryTileChars[index];
+
+        // Read length of run, long runs continue with varint
+        size_t run = (c & 0x1f) + 1;
+        if (run == 32) {
+            size_t shift = 0;
+            do {
+                if (!readByte(c) || shift >= 64) {
+                    throw FileLoaderException("BoardFileLoader: readBinaryTiles - wrong format of run");
+                }
+                run += (size_t) (c & 0x7f) << shift;
+                shift += 7;
+            } while (c & 0x80);
+        }
+
+        for (; run > 0; run--) {
+            if (y >= sizeY) {
+                throw FileLoaderException("BoardFileLoader: readBinaryTiles - too many tiles");
+            }
+            placeTile(generatedTiles, tile, x++, y);
+
+            if (x == sizeX) {
+                x = 0;
+                finishRows(generatedTiles, ++y);
+            }
+        }
+    }
+
+    if (y != sizeY) {
+        throw FileLoaderException("BoardFileLoader: readBinaryTiles - missing tiles");
     }
 
-    return Board::Tile::Type::space;
+    return generatedTiles;
 }
 
 BoardFileLoader::BoardFileLoader(const std::string & filePath)
     :
-    FileManager(filePath),
+    BoardFileManager(filePath),
     playerSpawn(-1, -1),
-    enemySpawn(-1, -1) { }
+    enemySpawn(-1, -1),
+    block(BOARDFILELOADERBLOCKSIZE),
+    blockPosition(0),
+    blockLength(0),
+    rowStartMovement(false) { }
 
 Board BoardFileLoader::loadBoard() {
-    std::list<std::string> lines;
-
-    std::string buffer;
-    size_t lineLength = 0;
-
-    while (std::getline(file, buffer)) { // Read lines from file
-
-        if (lineLength == 0) {
-             // If line is first with content set line length, else check if 
-             // loaded line length is correct
-            lineLength = buffer.length();
-        } else if (lineLength != buffer.length()) {
-            throw FileLoaderException("BoardFileLoader: loadBoard - wrong format of grid in file");
-        }
+    size_t sizeX = 0;
+    size_t sizeY = 0;
+    bool binary = readBinaryHeader(sizeX, sizeY);
+    if (!binary) {
+        measureGrid(sizeX, sizeY);
+    }
 
-        lines.emplace_back(buffer);
+    // Check if has minimal size
+    if (sizeX <= 2 || sizeY <= 2) {
+        throw FileLoaderException("BoardFileLoader: loadBoard - too small");
     }
 
-    if (lines.size() == 0) {
-        throw FileLoaderException("BoardFileLoader: loadBoard - empty grid");
+    firstRowMovement.assign(sizeX, false);
+    TileMatrix tiles = binary ? readBinaryTiles(sizeX, sizeY) : readTextTiles(sizeX, sizeY);
+
+    if ((enemySpawn.x == -1 || enemySpawn.y == -1)
+        || (playerSpawn.x == -1 || playerSpawn.y == -1)) { //Check if spawns have been set
+        throw FileLoaderException("BoardFileLoader: loadBoard - missing spawn point");
     }
 
-    return Board(createTilesOutOfData(lines), enemySpawn, playerSpawn);
-}
\ No newline at end of file
+    return Board(tiles, enemySpawn, playerSpawn);
+}
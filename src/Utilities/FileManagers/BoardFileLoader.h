@@ -11,24 +11,50 @@
 #ifndef BOARDFILELOADER_H
 #define BOARDFILELOADER_H
 
-#include "Utilities/FileManagers/FileManager.h"
+#include <vector>
+
+#include "Utilities/FileManagers/BoardFileManager.h"
 #include "GameLogic/Board.h"
 #include "Structures/Transforms/Transform.h"
-#include "Structures/Matrix.h"
+#include "Structures/ChunkedMatrix.h"
+
+#define BOARDFILELOADERBLOCKSIZE 65536 //< Number of bytes read from file at once
 
 /**
  * @brief File loader for Board
  *
- * Used for loading Board object from file.
+ * Used for loading Board object from file, text and binary format (see
+ * BoardFileManager) is recognized by beginning of file.
+ *
+ * File is read in blocks of BOARDFILELOADERBLOCKSIZE bytes and validated while
+ * it is read, tiles are stored in chunks (see ChunkedMatrix), so loader doesn't
+ * keep the file in memory and large areas of walls don't take memory.
  *
  */
-class BoardFileLoader : public FileManager {
+class BoardFileLoader : public BoardFileManager {
 private:
-    typedef Matrix<Board::Tile::Type> TileMatrix;
+    typedef ChunkedMatrix<Board::Tile::Type> TileMatrix;
 
     Position playerSpawn; //< Loaded player spawn
     Position enemySpawn; //< Loaded enemy spawn
 
+    std::vector<char> block; //< Block of file
+    size_t blockPosition; //< Position of next byte in block
+    size_t blockLength; //< Number of bytes in block
+
+    std::vector<bool> firstRowMovement; //< Tiles of the first row allowing movement,
+    // for checking teleports in the last row
+    bool rowStartMovement; //< First tile of current row allows movement
+
+    /**
+     * @brief Read next byte of file
+     *
+     * @param c read byte
+     * @return true byte was read
+     * @return false end of file
+     */
+    bool readByte(char & c);
+
     /**
      * @brief Check if char is special tile and load it into position at x, y coords
      *
@@ -45,26 +71,80 @@ private:
     bool checkForSpecialCharacter(char c, size_t x, size_t y);
 
     /**
-     * @brief Create matrix of tiles from lines from file
+     * @brief Place tile from char into matrix
+     *
+     * Also processes special characters using checkForSpecialCharacter and checks
+     * teleports, tiles need to be placed by rows.
+     *
+     * @throws FileLoaderException wrong teleport
+     *
+     * @param tiles matrix of tiles
+     * @param c char from file
+     * @param x x coord of tile
+     * @param y y coord of tile
+     */
+    void placeTile(TileMatrix & tiles, char c, size_t x, size_t y);
+
+    /**
+     * @brief Share chunks of finished rows
+     *
+     * @param tiles matrix of tiles
+     * @param y number of finished rows
+     */
+    void finishRows(TileMatrix & tiles, size_t y);
+
+    /**
+     * @brief Get size of grid in text file
      *
-     * Also processes special characters using checkForSpecialCharacter
+     * Size in x dimension is length of the first line, size in y dimension is
+     * computed from size of file (lines of grid have the same length, last line
+     * doesn't need to end with newline).
      *
-     * @throws FileLoaderException missing player or enemy spawn
-     * @throws FileLoaderException too small
+     * @throws FileLoaderException empty grid
+     * @throws FileLoaderException wrong format
+     *
+     * @param sizeX size in x dimension
+     * @param sizeY size in y dimension
+     */
+    void measureGrid(size_t & sizeX, size_t & sizeY);
+
+    /**
+     * @brief Read matrix of tiles from text file
+     *
+     * @throws FileLoaderException wrong format
      * @throws FileLoaderException wrong teleport
      *
-     * @param lines lines from file
+     * @param sizeX size of grid in x dimension
+     * @param sizeY size of grid in y dimension
      * @return TileMatrix
      */
-    TileMatrix createTilesOutOfData(std::list<std::string> & lines);
+    TileMatrix readTextTiles(size_t sizeX, size_t sizeY);
 
     /**
-     * @brief Convert char from loaded file to Board::Tile::Type
+     * @brief Check if file is binary
      *
-     * @param c char from file
-     * @return Board::Tile::Type
+     * If it is, reads its header.
+     *
+     * @throws FileLoaderException wrong format
+     *
+     * @param sizeX size of grid in x dimension
+     * @param sizeY size of grid in y dimension
+     * @return true file is binary
+     * @return false file is text
+     */
+    bool readBinaryHeader(size_t & sizeX, size_t & sizeY);
+
+    /**
+     * @brief Read matrix of tiles from binary file
+     *
+     * @throws FileLoaderException wrong format
+     * @throws FileLoaderException wrong teleport
+     *
+     * @param sizeX size of grid in x dimension
+     * @param sizeY size of grid in y dimension
+     * @return TileMatrix
      */
-    static Board::Tile::Type dataCharToType(char c);
+    TileMatrix readBinaryTiles(size_t sizeX, size_t sizeY);
 
 public:
     /**
@@ -81,6 +161,9 @@ public:
      *
      * @throw FileLoaderException wrong format
      * @throw FileLoaderException empty grid
+     * @throw FileLoaderException too small
+     * @throw FileLoaderException wrong teleport
+     * @throw FileLoaderException missing player or enemy spawn
      *
      * @return Board
      */
@@ -88,4 +171,4 @@ public:
 
 };
 
-#endif /* BOARDFILELOADER_H */
\ No newline at end of file
+#endif /* BOARDFILELOADER_H */
@@ -0,0 +1,43 @@
+#include "Utilities/FileManagers/BoardFileManager.h"
+
+const std::string BoardFileManager::binaryMagic = "MPACB";
+const std::string BoardFileManager::binaryTileChars = "# .oPE";
+
+Board::Tile::Type BoardFileManager::dataCharToType(char c) {
+    switch (c) { // Map chars to types
+        case '#':
+            return Board::Tile::Type::wall;
+            break;
+        case '.':
+            return Board::Tile::Type::coin;
+        case 'o':
+            return Board::Tile::Type::frighten;
+        case ' ':
+            break;
+        default:
+            throw FileLoaderException("BoardFileLoader: dataCharToType - unknown char in file");
+            break;
+    }
+
+    return Board::Tile::Type::space;
+}
+
+char BoardFileManager::typeToDataChar(const Board::Tile::Type & t) {
+    switch (t) { // Map types to chars
+        case Board::Tile::Type::wall:
+            return '#';
+        case Board::Tile::Type::coin:
+            return '.';
+        case Board::Tile::Type::frighten:
+            return 'o';
+        default:
+            break;
+    }
+
+    return ' ';
+}
+
+BoardFileManager::BoardFileManager(const std::string & filePath, bool write)
+    : FileManager(filePath, write) { }
+
+BoardFileManager::~BoardFileManager() { }
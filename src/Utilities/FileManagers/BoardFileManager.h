@@ -0,0 +1,82 @@
+/****************************************************************
+ * @file BoardFileManager.h
+ * @author Michal Dobes
+ * @brief Board file manager
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef BOARDFILEMANAGER_H
+#define BOARDFILEMANAGER_H
+
+#include <string>
+
+#include "Utilities/FileManagers/FileManager.h"
+#include "GameLogic/Board.h"
+
+/**
+ * @brief File manager for board file
+ *
+ * Board is stored either as text (.mpac), where each line is row of board and
+ * each char is tile, or as binary (.mpacb), which stores the same chars in runs:
+ *  - magic "MPACB" and version byte
+ *  - size in x and size in y dimension, each 4 bytes little endian
+ *  - runs of tiles in rows from top to bottom (runs may continue to next row),
+ *    run starts with byte, whose highest three bits are index of char of tile
+ *    in binaryTileChars and lowest five bits are length of run minus one, if they
+ *    are all ones, length minus 32 follows as LEB128 varint
+ *
+ */
+class BoardFileManager : public FileManager {
+protected:
+    static const std::string binaryMagic; //< Beginning of binary file
+    static const std::string binaryTileChars; //< Chars of tiles in binary file by their index
+    static constexpr unsigned char binaryVersion = 1; //< Version of binary format
+
+    static constexpr char playerSpawnChar = 'P'; //< Char of player spawn
+    static constexpr char enemySpawnChar = 'E'; //< Char of enemy spawn
+
+    /**
+     * @brief Convert char from file to Board::Tile::Type
+     *
+     * @throw FileLoaderException unknown char
+     *
+     * @param c char from file
+     * @return Board::Tile::Type
+     */
+    static Board::Tile::Type dataCharToType(char c);
+
+    /**
+     * @brief Convert Board::Tile::Type to char in file
+     *
+     * Bonus tiles are not stored, default tile is used instead.
+     *
+     * @param t type of tile
+     * @return char
+     */
+    static char typeToDataChar(const Board::Tile::Type & t);
+
+public:
+
+    /**
+     * @brief Construct a new Board File Manager object
+     *
+     * Tries to open the file
+     *
+     * @throw FileLoaderException failed to utilize file
+     *
+     * @param filePath path to file
+     * @param write open for write, else opens for read
+     */
+    BoardFileManager(const std::string & filePath, bool write = false);
+
+    /**
+     * @brief Destroy the Board File Manager object
+     *
+     */
+    virtual ~BoardFileManager();
+};
+
+#endif /* BOARDFILEMANAGER_H */
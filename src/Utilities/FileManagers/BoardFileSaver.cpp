@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utilities/FileManagers/BoardFileSaver.h"
+
+char BoardFileSaver::tileChar(const Board & board, const Board::Tile::Type & t, size_t x, size_t y) {
+    Position pos(x, y);
+    if (pos == board.getPlayerSpawn()) {
+        return playerSpawnChar;
+    }
+    if (pos == board.getEnemySpawn()) {
+        return enemySpawnChar;
+    }
+    return typeToDataChar(t);
+}
+
+void BoardFileSaver::writeRun(char c, size_t length) {
+    unsigned char index = binaryTileChars.find(c);
+    if (length < 32) {
+        file.put((index << 5) | (length - 1));
+        return;
+    }
+
+    file.put((index << 5) | 0x1f);
+    length -= 32;
+    do { // LEB128, seven bits at a time, highest bit marks continuation
+        unsigned char byte = length & 0x7f;
+        length >>= 7;
+        file.put((length != 0) ? (byte | 0x80) : byte);
+    } while (length != 0);
+}
+
+BoardFileSaver::BoardFileSaver(const std::string & filePath, bool binaryFormat)
+    :
+    BoardFileManager(filePath, true),
+    binary(binaryFormat) { }
+
+void BoardFileSaver::writeBoard(const Board & board) {
+    size_t sizeX = board.getSizeX();
+    size_t sizeY = board.getSizeY();
+
+    std::vector<Board::Tile::Type> buffer;
+
+    if (!binary) {
+        std::string line(sizeX, ' ');
+        for (size_t y = 0; y < sizeY; y++) {
+            const Board::Tile::Type * row = board.tileRow(y, 0, sizeX, buffer);
+            for (size_t x = 0; x < sizeX; x++) {
+                line[x] = tileChar(board, row[x], x, y);
+            }
+            file << line << '\n';
+        }
+    } else {
+        if (sizeX > UINT32_MAX || sizeY > UINT32_MAX) {
+            throw FileLoaderException("BoardFileSaver: writeBoard - board too large");
+        }
+
+        file << binaryMagic;
+        file.put(binaryVersion);
+        for (size_t size : { sizeX, sizeY }) {
+            for (size_t i = 0; i < 4; i++) {
+                file.put((size >> (8 * i)) & 0xff);
+            }
+        }
+
+        // Runs continue over ends of rows
+        char runChar = 0;
+        size_t runLength = 0;
+        for (size_t y = 0; y < sizeY; y++) {
+            const Board::Tile::Type * row = board.tileRow(y, 0, sizeX, buffer);
+            for (size_t x = 0; x < sizeX; x++) {
+                char c = tileChar(board, row[x], x, y);
+                if (c != runChar && runLength != 0) {
+                    writeRun(runChar, runLength);
+                    runLength = 0;
+                }
+                runChar = c;
+                runLength++;
+            }
+        }
+        writeRun(runChar, runLength);
+    }
+
+    if (!file.good()) {
+        throw FileLoaderException("BoardFileSaver: writeBoard - couldnt write");
+    }
+}
@@ -0,0 +1,71 @@
+/****************************************************************
+ * @file BoardFileSaver.h
+ * @author Michal Dobes
+ * @brief File saver for board
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef BOARDFILESAVER_H
+#define BOARDFILESAVER_H
+
+#include "Utilities/FileManagers/BoardFileManager.h"
+#include "GameLogic/Board.h"
+
+/**
+ * @brief File saver for Board
+ *
+ * Used for saving Board object to file in text or binary format (see
+ * BoardFileManager). Board is written by rows, without keeping whole file
+ * in memory.
+ *
+ */
+class BoardFileSaver : public BoardFileManager {
+private:
+    bool binary; //< Save in binary format
+
+    /**
+     * @brief Get char of tile in file, including spawns
+     *
+     * @param board board
+     * @param t type of tile
+     * @param x x coord of tile
+     * @param y y coord of tile
+     * @return char
+     */
+    static char tileChar(const Board & board, const Board::Tile::Type & t, size_t x, size_t y);
+
+    /**
+     * @brief Write run of tiles in binary format
+     *
+     * @param c char of tiles
+     * @param length number of tiles
+     */
+    void writeRun(char c, size_t length);
+
+public:
+    /**
+     * @brief Construct a new Board File Saver object
+     *
+     * Tries to overwrite/create the file
+     *
+     * @throw FileLoaderException failed to utilize file
+     *
+     * @param filePath path to new map file
+     * @param binaryFormat save in binary format, else in text format
+     */
+    BoardFileSaver(const std::string & filePath, bool binaryFormat = false);
+
+    /**
+     * @brief Attempt to write board into file
+     *
+     * @throw FileLoaderException couldn't write board or board too large for format
+     *
+     * @param board board to write
+     */
+    void writeBoard(const Board & board);
+};
+
+#endif /* BOARDFILESAVER_H */
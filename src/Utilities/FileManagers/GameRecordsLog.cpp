@@ -0,0 +1,328 @@
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Utilities/FileManagers/GameRecordsLog.h"
+
+namespace {
+    /**
+     * @brief Write whole buffer into file descriptor
+     *
+     * @param fd file descriptor
+     * @param data data to write
+     * @return true everything was written
+     * @return false write failed
+     */
+    bool writeAll(int fd, const std::string & data) {
+        size_t written = 0;
+        while (written < data.size()) {
+            ssize_t result = write(fd, data.data() + written, data.size() - written);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                return false;
+            }
+            written += result;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Advisory lock of records log held until destruction
+     *
+     * Lock is taken on separate lock file, because log itself is replaced
+     * by compaction.
+     *
+     */
+    class LogLock {
+    private:
+        int fd; //< Descriptor of lock file, -1 if not locked
+
+    public:
+        /**
+         * @brief Construct a new Log Lock object and try to lock
+         *
+         * @param path path to lock file
+         * @param exclusive take exclusive lock, else shared
+         * @param wait wait until lock is available, else give up
+         */
+        LogLock(const std::string & path, bool exclusive, bool wait) {
+            fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd < 0) {
+                return;
+            }
+
+            int operation = (exclusive ? LOCK_EX : LOCK_SH) | (wait ? 0 : LOCK_NB);
+            int result;
+            while ((result = flock(fd, operation)) != 0 && errno == EINTR) { }
+            if (result != 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+
+        LogLock(const LogLock &) = delete;
+        LogLock & operator=(const LogLock &) = delete;
+
+        /**
+         * @brief Destroy the Log Lock object, releasing the lock
+         *
+         */
+        ~LogLock() {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+
+        /**
+         * @brief Check if lock was taken
+         *
+         * @return true
+         * @return false
+         */
+        bool isLocked() const {
+            return fd >= 0;
+        }
+    };
+
+    /**
+     * @brief Get length of file up to and including its last newline
+     *
+     * @param fd file descriptor opened for reading
+     * @param size size of file
+     * @return off_t length of complete lines, -1 if file couldn't be read
+     */
+    off_t completeLength(int fd, off_t size) {
+        char buffer[512];
+        off_t end = size;
+        while (end > 0) {
+            off_t begin = std::max<off_t>(0, end - (off_t)sizeof(buffer));
+            if (pread(fd, buffer, end - begin, begin) != end - begin) {
+                return -1;
+            }
+            for (off_t i = end - begin; i > 0; i--) {
+                if (buffer[i - 1] == '\n') {
+                    return begin + i;
+                }
+            }
+            end = begin;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Format runs with score as line of log
+     *
+     * @return std::string line including terminating newline
+     */
+    std::string recordLine(const std::string & map, unsigned int difficulty, unsigned long score, size_t runs = 1) {
+        std::string line = map + '\t' + std::to_string(difficulty) + '\t' + std::to_string(score);
+        if (runs != 1) {
+            line += '\t' + std::to_string(runs);
+        }
+        return line + '\n';
+    }
+}
+
+GameRecordsLog::GameRecordsLog(const std::string & settingsPath)
+    : logPath(settingsPath + RECORDSLOGEXTENSION), loggedLines(0) { }
+
+bool GameRecordsLog::parseLine(const std::string & line, GameRecords & records) {
+    // Fields are map, difficulty, score and optional number of runs
+    size_t mapEnd = line.find('\t');
+    if (mapEnd == 0 || mapEnd == std::string::npos) {
+        return false;
+    }
+
+    unsigned long numbers[3] = { 0, 0, 1 };
+    size_t fields = 0;
+    const char * current = line.c_str() + mapEnd;
+    const char * end = line.c_str() + line.size();
+    while (current != end) {
+        if (fields == 3 || *current != '\t' || !std::isdigit((unsigned char)current[1])) {
+            return false;
+        }
+        errno = 0;
+        char * parsed;
+        numbers[fields++] = std::strtoul(current + 1, &parsed, 10);
+        if (errno == ERANGE) {
+            return false;
+        }
+        current = parsed;
+    }
+    if (fields < 2) {
+        return false;
+    }
+
+    records.addScore(line.substr(0, mapEnd), numbers[0], numbers[1], numbers[2]);
+    return true;
+}
+
+size_t GameRecordsLog::readLog(GameRecords & records) const {
+    std::error_code error;
+    if (!std::filesystem::exists(logPath, error)) {
+        return 0;
+    }
+
+    std::ifstream file(logPath);
+    if (!file.is_open()) {
+        throw FileLoaderException("GameRecordsLog: readLog - couldn't open log");
+    }
+
+    size_t lines = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (file.eof()) {
+            break; //< Line without newline was interrupted
+        }
+        lines++;
+        parseLine(line, records); //< Malformed lines are skipped
+    }
+
+    if (file.bad()) {
+        throw FileLoaderException("GameRecordsLog: readLog - couldn't read log");
+    }
+    return lines;
+}
+
+void GameRecordsLog::load(GameRecords & records) {
+    logged = GameRecords();
+    loggedLines = readLog(logged);
+
+    for (auto & r : logged.getRecords()) {
+        records.addScore(r.map, r.difficulty, r.score, r.runs);
+    }
+}
+
+void GameRecordsLog::append(const std::string & map, unsigned int difficulty, unsigned long score) {
+    appendRuns({ GameRecords::Record { map, difficulty, score, 1 } });
+}
+
+void GameRecordsLog::appendRuns(const std::vector<GameRecords::Record> & runs) {
+    std::string content;
+    for (auto & r : runs) {
+        if (r.map.empty() || r.map.find_first_of("\t\n") != std::string::npos) {
+            throw FileLoaderException("GameRecordsLog: appendRuns - map name can't be logged");
+        }
+        if (r.runs > 0) {
+            content += recordLine(r.map, r.difficulty, r.score, r.runs);
+        }
+    }
+    if (content.empty()) {
+        return;
+    }
+
+    // Appends share the lock, only compaction and removal of interrupted line
+    // need the log for themselves
+    bool exclusive = false;
+    while (true) {
+        LogLock lock(lockPath(), exclusive, true);
+        if (!lock.isLocked()) {
+            throw FileLoaderException("GameRecordsLog: appendRuns - couldn't lock log");
+        }
+
+        int fd = open(logPath.c_str(), O_RDWR | O_APPEND | O_CREAT, 0644);
+        if (fd < 0) {
+            throw FileLoaderException("GameRecordsLog: appendRuns - couldn't open log");
+        }
+
+        // Line interrupted by crash is removed, so it can't be completed into a record,
+        // while others append the end of log may be unfinished write, so it is checked
+        // again under exclusive lock
+        struct stat status;
+        off_t complete = 0;
+        bool success = fstat(fd, &status) == 0
+            && (complete = completeLength(fd, status.st_size)) >= 0;
+        if (success && complete != status.st_size) {
+            if (!exclusive) {
+                close(fd);
+                exclusive = true;
+                continue;
+            }
+            success = ftruncate(fd, complete) == 0;
+        }
+
+        // One write of whole content, so appends of others are not interleaved with it
+        success = success && writeAll(fd, content) && fdatasync(fd) == 0;
+        close(fd);
+        if (!success) {
+            throw FileLoaderException("GameRecordsLog: appendRuns - couldn't write into log");
+        }
+        break;
+    }
+
+    for (auto & r : runs) {
+        if (r.runs > 0) {
+            loggedLines++;
+            logged.addScore(r.map, r.difficulty, r.score, r.runs);
+        }
+    }
+
+    if (loggedLines >= RECORDSLOGCOMPACTMINLINES && loggedLines > 2 * logged.getDistinctScores()) {
+        try {
+            compact(false); //< If log is busy, someone else is compacting or will compact later
+        }
+        catch (FileLoaderException & e) { } //< Runs are already stored, log is compacted next time
+    }
+}
+
+bool GameRecordsLog::compact(bool wait) {
+    LogLock lock(lockPath(), true, wait);
+    if (!lock.isLocked()) {
+        if (wait) {
+            throw FileLoaderException("GameRecordsLog: compact - couldn't lock log");
+        }
+        return false;
+    }
+
+    GameRecords current;
+    readLog(current);
+
+    std::string content;
+    for (auto & r : current.getRecords()) {
+        content += recordLine(r.map, r.difficulty, r.score, r.runs);
+    }
+
+    // Log is replaced only by complete and synced file
+    std::string temporaryPath = logPath + ".tmp";
+    int fd = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw FileLoaderException("GameRecordsLog: compact - couldn't create temporary file");
+    }
+    bool success = writeAll(fd, content) && fsync(fd) == 0;
+    close(fd);
+
+    if (!success || rename(temporaryPath.c_str(), logPath.c_str()) != 0) {
+        unlink(temporaryPath.c_str());
+        throw FileLoaderException("GameRecordsLog: compact - couldn't replace log");
+    }
+
+    // Rename is durable only after directory is synced
+    std::filesystem::path directory = std::filesystem::path(logPath).parent_path();
+    int directoryFd = open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (directoryFd >= 0) {
+        fsync(directoryFd);
+        close(directoryFd);
+    }
+
+    logged = current;
+    loggedLines = logged.getDistinctScores();
+    return true;
+}
+
+std::string GameRecordsLog::lockPath() const {
+    return logPath + RECORDSLOGLOCKEXTENSION;
+}
+
+const std::string & GameRecordsLog::getLogPath() const {
+    return logPath;
+}
@@ -0,0 +1,147 @@
+/****************************************************************
+ * @file GameRecordsLog.h
+ * @author Michal Dobes
+ * @brief Append-only log of game records
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef GAMERECORDSLOG_H
+#define GAMERECORDSLOG_H
+
+#include <string>
+#include <vector>
+
+#include "Utilities/FileManagers/FileManager.h"
+#include "Utilities/Contexts/GameRecords.h"
+
+#define RECORDSLOGEXTENSION ".records" //< Appended to path of settings file
+#define RECORDSLOGLOCKEXTENSION ".lock" //< Appended to path of log for lock file
+#define RECORDSLOGCOMPACTMINLINES 64 //< Log is never compacted while it has fewer lines
+
+/**
+ * @brief Append-only log of game records
+ *
+ * Runs played with settings file are stored next to it in file with
+ * RECORDSLOGEXTENSION appended to its name, so settings file is never rewritten.
+ * Each line of log is `map\tdifficulty\tscore`, optionally followed by
+ * `\truns` if more runs reached the score. Finished run is one append of
+ * whole line, synced to disk.
+ *
+ * Line that is not terminated (write interrupted by crash) is ignored, next
+ * append removes it under exclusive lock first, so it never becomes a record.
+ *
+ * Once the log has more than twice as many lines as distinct scores, it is
+ * compacted: each distinct score is written once with its number of runs into
+ * temporary file, which then atomically replaces the log.
+ *
+ * Log may be shared by more processes. Appends hold shared flock of lock file
+ * next to the log (appends of whole lines don't interleave), compaction holds
+ * exclusive lock, so no append is lost by replacing the log.
+ *
+ */
+class GameRecordsLog {
+private:
+    std::string logPath; //< Path to log
+    size_t loggedLines; //< Lines in log known to this object
+    GameRecords logged; //< Runs in log known to this object
+
+    /**
+     * @brief Read records from log
+     *
+     * @throw FileLoaderException log exists, but couldn't be read
+     *
+     * @param records records to add logged scores into
+     * @return size_t number of complete lines in log
+     */
+    size_t readLog(GameRecords & records) const;
+
+    /**
+     * @brief Parse one line of log
+     *
+     * @param line line without terminating newline
+     * @param records records to add score into
+     * @return true line is valid
+     * @return false line is malformed
+     */
+    static bool parseLine(const std::string & line, GameRecords & records);
+
+    /**
+     * @brief Get path to lock file of log
+     *
+     * @return std::string
+     */
+    std::string lockPath() const;
+
+public:
+    /**
+     * @brief Construct a new Game Records Log object
+     *
+     * File is not opened until it is used.
+     *
+     * @param settingsPath path to settings file which records belong to
+     */
+    GameRecordsLog(const std::string & settingsPath);
+
+    /**
+     * @brief Add records from log
+     *
+     * Missing log is the same as empty log.
+     *
+     * @throw FileLoaderException log exists, but couldn't be read
+     *
+     * @param records records to add logged scores into
+     */
+    void load(GameRecords & records);
+
+    /**
+     * @brief Append run to log
+     *
+     * Compacts the log afterwards, if it grew too long.
+     *
+     * @throw FileLoaderException couldn't write into log, or map name can't be logged
+     *
+     * @param map map file name
+     * @param difficulty difficulty of game
+     * @param score reached score
+     */
+    void append(const std::string & map, unsigned int difficulty, unsigned long score);
+
+    /**
+     * @brief Append runs to log at once
+     *
+     * All runs are written by one write and synced once, so it is much faster
+     * than appending runs one by one. Compacts the log afterwards, if it grew
+     * too long.
+     *
+     * @throw FileLoaderException couldn't write into log, or map name can't be logged
+     *
+     * @param runs runs to append
+     */
+    void appendRuns(const std::vector<GameRecords::Record> & runs);
+
+    /**
+     * @brief Rewrite log with each distinct score only once
+     *
+     * Log is read again under exclusive lock before rewriting, so runs appended
+     * by others since it was loaded are kept.
+     *
+     * @throw FileLoaderException couldn't lock, read or replace log, original log is kept
+     *
+     * @param wait wait until others finish their appends, else give up if log is busy
+     * @return true log was compacted
+     * @return false log was busy
+     */
+    bool compact(bool wait = true);
+
+    /**
+     * @brief Get path to log
+     *
+     * @return const std::string&
+     */
+    const std::string & getLogPath() const;
+};
+
+#endif /* GAMERECORDSLOG_H */
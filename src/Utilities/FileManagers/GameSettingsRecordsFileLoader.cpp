@@ -2,6 +2,39 @@
 #include <string>
 
 #include "Utilities/FileManagers/GameSettingsRecordsFileLoader.h"
+#include "GameLogic/Entities/Enemies.h"
+
+void GameSettingsRecordsFileLoader::loadOptionalSetting(const std::string & key, GameSettings & settings) {
+    if (key == optionalKeys[1]) { //< Ghost group has multiple values
+        GameSettings::GhostGroup group;
+        file >> group.type >> group.count >> group.scatterX >> group.scatterY >> group.release;
+        if (file.fail() || group.count == 0 || !Enemies::typeFromName(group.type)) {
+            throw FileLoaderException("GameFileLoader: loadOptionalSetting - wrong format of ghost in file");
+        }
+
+        size_t ghosts = group.count;
+        for (auto & g : settings.ghostRoster) {
+            ghosts += g.count;
+        }
+        if (ghosts > GAMEMAXGHOSTS) {
+            throw FileLoaderException("GameFileLoader: loadOptionalSetting - too many ghosts in file");
+        }
+        settings.ghostRoster.push_back(group);
+        return;
+    }
+
+    unsigned int valueBuffer;
+    file >> valueBuffer;
+    if (file.fail() || valueBuffer == 0) {
+        throw FileLoaderException("GameFileLoader: loadOptionalSetting - wrong format of value in file");
+    }
+
+    if (key == optionalKeys[0]) {
+        settings.ghostSearchBudget = valueBuffer;
+    } else {
+        throw FileLoaderException("GameFileLoader: loadOptionalSetting - unknown key in file");
+    }
+}
 
 GameSettingsRecordsFileLoader::GameSettingsRecordsFileLoader(const std::string & filePath)
     : GameSettingsRecordsFileManager(filePath) { }
@@ -31,12 +64,21 @@ std::pair<GameSettings, GameRecords> GameSettingsRecordsFileLoader::loadSettings
         values[6],
         values[7]);
 
-    // Load records
+    // Load optional settings and records, keys of optional settings end with '>'
+    // so they can't be confused with map names
     GameRecords loadedRecords;
     std::string bufferMapName;
     unsigned int bufferDifficulty;
     unsigned int bufferScore;
-    while (file >> bufferMapName >> bufferDifficulty >> bufferScore) {
+    while (file >> bufferMapName) {
+        if (bufferMapName.back() == '>') {
+            loadOptionalSetting(bufferMapName, loadedSettings);
+            continue;
+        }
+
+        if (!(file >> bufferDifficulty >> bufferScore)) {
+            break;
+        }
         loadedRecords.addScore(bufferMapName, bufferDifficulty, bufferScore);
     }
 
@@ -20,6 +20,17 @@
  *
  */
 class GameSettingsRecordsFileLoader : public GameSettingsRecordsFileManager {
+private:
+    /**
+     * @brief Load value of optional setting with key from file
+     *
+     * @throw FileLoaderException unknown key or wrong value
+     *
+     * @param key key of optional setting
+     * @param settings settings to load value into
+     */
+    void loadOptionalSetting(const std::string & key, GameSettings & settings);
+
 public:
     /**
      * @brief Construct a new Game Settings Records File Loader object
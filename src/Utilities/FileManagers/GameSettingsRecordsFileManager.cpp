@@ -11,6 +11,11 @@ const std::array<std::string, 8> GameSettingsRecordsFileManager::keys = {
     "ghost_begin_period>"
 };
 
+const std::array<std::string, 2> GameSettingsRecordsFileManager::optionalKeys = {
+    "ghost_search_budget>",
+    "ghost>"
+};
+
 GameSettingsRecordsFileManager::GameSettingsRecordsFileManager(const std::string & filepath, bool write)
     : FileManager(filepath, write) { }
 
@@ -26,6 +26,8 @@
 class GameSettingsRecordsFileManager : public FileManager {
 protected:
     static const std::array<std::string, 8> keys; //< Keys in settings file
+    static const std::array<std::string, 2> optionalKeys; //< Keys of optional settings,
+    // which may follow after settings with keys
 
 public:
 
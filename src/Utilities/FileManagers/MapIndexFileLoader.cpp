@@ -0,0 +1,39 @@
+#include <sstream>
+
+#include "Utilities/FileManagers/MapIndexFileLoader.h"
+
+MapIndexFileLoader::MapIndexFileLoader(const std::string & filePath)
+    : MapIndexFileManager(filePath) { }
+
+std::vector<MapIndex::Entry> MapIndexFileLoader::loadEntries() {
+    std::string line;
+    std::string keyBuffer;
+    unsigned int versionBuffer;
+
+    std::getline(file, line);
+    std::istringstream header(line);
+    if (!(header >> keyBuffer >> versionBuffer) || keyBuffer != headerKey || versionBuffer != version) {
+        throw FileLoaderException("MapIndexFileLoader: loadEntries - wrong header");
+    }
+
+    std::vector<MapIndex::Entry> entries;
+    while (std::getline(file, line)) {
+        // Name can contain spaces, so it is separated by tab
+        size_t tab = line.find('\t');
+        if (tab == std::string::npos || tab == 0) {
+            continue;
+        }
+
+        MapIndex::Entry entry;
+        entry.name = line.substr(0, tab);
+
+        std::istringstream values(line.substr(tab + 1));
+        if (!(values >> entry.modified >> entry.fileSize >> entry.sizeX >> entry.sizeY
+            >> entry.coins >> entry.valid)) {
+            continue;
+        }
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
@@ -0,0 +1,49 @@
+/****************************************************************
+ * @file MapIndexFileLoader.h
+ * @author Michal Dobes
+ * @brief Map index file loader
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPINDEXFILELOADER_H
+#define MAPINDEXFILELOADER_H
+
+#include <vector>
+
+#include "Utilities/FileManagers/MapIndexFileManager.h"
+
+/**
+ * @brief Map index file loader
+ *
+ * Used for loading entries of MapIndex from file.
+ *
+ */
+class MapIndexFileLoader : public MapIndexFileManager {
+public:
+    /**
+     * @brief Construct a new Map Index File Loader object
+     *
+     * Tries to open the file
+     *
+     * @throw FileLoaderException failed to utilize file
+     *
+     * @param filePath path to map index file
+     */
+    MapIndexFileLoader(const std::string & filePath);
+
+    /**
+     * @brief Attempts to load entries from file
+     *
+     * Lines with wrong format are skipped (the maps are described again).
+     *
+     * @throw FileLoaderException wrong header or version
+     *
+     * @return std::vector<MapIndex::Entry>
+     */
+    std::vector<MapIndex::Entry> loadEntries();
+};
+
+#endif /* MAPINDEXFILELOADER_H */
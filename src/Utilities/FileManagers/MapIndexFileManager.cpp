@@ -0,0 +1,9 @@
+#include "Utilities/FileManagers/MapIndexFileManager.h"
+
+const std::string MapIndexFileManager::headerKey = "mapindex>";
+const unsigned int MapIndexFileManager::version = 2;
+
+MapIndexFileManager::MapIndexFileManager(const std::string & filePath, bool write)
+    : FileManager(filePath, write) { }
+
+MapIndexFileManager::~MapIndexFileManager() { }
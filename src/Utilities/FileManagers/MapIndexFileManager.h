@@ -0,0 +1,53 @@
+/****************************************************************
+ * @file MapIndexFileManager.h
+ * @author Michal Dobes
+ * @brief Map index file manager
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPINDEXFILEMANAGER_H
+#define MAPINDEXFILEMANAGER_H
+
+#include <string>
+
+#include "Utilities/FileManagers/FileManager.h"
+#include "Utilities/Contexts/MapIndex.h"
+
+/**
+ * @brief File manager for map index file
+ *
+ * File starts with header key and version, then each line is one entry with
+ * values separated by tabs (name, modification time, file size, size in x,
+ * size in y, coins, validity).
+ *
+ */
+class MapIndexFileManager : public FileManager {
+protected:
+    static const std::string headerKey; //< Key at beginning of file
+    static const unsigned int version; //< Version of format
+
+public:
+
+    /**
+     * @brief Construct a new Map Index File Manager object
+     *
+     * Tries to open the file
+     *
+     * @throw FileLoaderException failed to utilize file
+     *
+     * @param filePath path to file
+     * @param write open for write, else opens for read
+     */
+    MapIndexFileManager(const std::string & filePath, bool write = false);
+
+    /**
+     * @brief Destroy the Map Index File Manager object
+     *
+     */
+    virtual ~MapIndexFileManager();
+};
+
+#endif /* MAPINDEXFILEMANAGER_H */
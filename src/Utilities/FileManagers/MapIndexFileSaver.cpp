@@ -0,0 +1,22 @@
+#include "Utilities/FileManagers/MapIndexFileSaver.h"
+
+MapIndexFileSaver::MapIndexFileSaver(const std::string & filePath)
+    : MapIndexFileManager(filePath, true) { }
+
+void MapIndexFileSaver::writeEntries(const std::vector<MapIndex::Entry> & entries) {
+    file << headerKey << '\t' << version << '\n';
+
+    for (auto & e : entries) {
+        if (e.name.find_first_of("\t\n") != std::string::npos) { //< Name can't be stored, map
+            // will be described again
+            continue;
+        }
+        file << e.name << '\t' << e.modified << '\t' << e.fileSize
+            << '\t' << e.sizeX << '\t' << e.sizeY << '\t' << e.coins
+            << '\t' << e.valid << '\n';
+    }
+
+    if (!file.good()) {
+        throw FileLoaderException("MapIndexFileSaver: writeEntries - couldnt write");
+    }
+}
@@ -0,0 +1,47 @@
+/****************************************************************
+ * @file MapIndexFileSaver.h
+ * @author Michal Dobes
+ * @brief Map index file saver
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef MAPINDEXFILESAVER_H
+#define MAPINDEXFILESAVER_H
+
+#include <vector>
+
+#include "Utilities/FileManagers/MapIndexFileManager.h"
+
+/**
+ * @brief Map index file saver
+ *
+ * Used for saving entries of MapIndex to file.
+ *
+ */
+class MapIndexFileSaver : public MapIndexFileManager {
+public:
+    /**
+     * @brief Construct a new Map Index File Saver object
+     *
+     * Tries to overwrite/create the file
+     *
+     * @throw FileLoaderException failed to utilize file
+     *
+     * @param filePath path to new map index file
+     */
+    MapIndexFileSaver(const std::string & filePath);
+
+    /**
+     * @brief Attempt to write entries into file
+     *
+     * @throw FileLoaderException couldn't write entries
+     *
+     * @param entries entries to write
+     */
+    void writeEntries(const std::vector<MapIndex::Entry> & entries);
+};
+
+#endif /* MAPINDEXFILESAVER_H */
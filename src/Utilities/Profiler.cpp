@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+#include "Utilities/Profiler.h"
+
+bool Profiler::enabled = false;
+std::string Profiler::summaryPath;
+std::array<Histogram, Profiler::phaseCount> Profiler::histograms;
+std::vector<Profiler::TriggerLateness> Profiler::lateness;
+
+void Profiler::enable(const std::string & path) {
+    summaryPath = path;
+    enabled = true;
+}
+
+bool Profiler::enableFromEnvironment() {
+    const char * path = std::getenv(PROFILERENVIRONMENTVARIABLE);
+    if (path != nullptr && *path != '\0') {
+        enable(path);
+    }
+    return enabled;
+}
+
+bool Profiler::isEnabled() {
+    return enabled;
+}
+
+void Profiler::record(Phase phase, uint64_t nanoseconds) {
+    histograms[phase].record(nanoseconds);
+}
+
+void Profiler::recordLateness(const std::string & name, const Histogram & performed, uint64_t skipped) {
+    if (!enabled) {
+        return;
+    }
+
+    for (auto & trigger : lateness) {
+        if (trigger.name == name) {
+            trigger.performed.merge(performed);
+            trigger.skipped += skipped;
+            return;
+        }
+    }
+    lateness.push_back(TriggerLateness { name, performed, skipped });
+}
+
+const Histogram & Profiler::getHistogram(Phase phase) {
+    return histograms[phase];
+}
+
+const char * Profiler::phaseName(Phase phase) {
+    switch (phase) {
+        case timerUpdate:
+            return "timer update";
+        case movePlayer:
+            return "move player";
+        case moveEnemy:
+            return "move enemy";
+        case detectCollisions:
+            return "detect collisions";
+        case drawGame:
+            return "draw game";
+        case screenUpdate:
+            return "screen update";
+        case input:
+            return "input";
+        default:
+            return "unknown";
+    }
+}
+
+void Profiler::writeSummary(std::ostream & out) {
+    out << std::left << std::setw(20) << "phase" << std::right
+        << std::setw(12) << "count"
+        << std::setw(12) << "p50 [us]"
+        << std::setw(12) << "p99 [us]"
+        << std::setw(12) << "max [us]"
+        << std::setw(14) << "total [ms]" << '\n';
+
+    out << std::fixed << std::setprecision(1);
+    for (unsigned int p = 0; p < phaseCount; p++) {
+        const Histogram & h = histograms[p];
+        out << std::left << std::setw(20) << phaseName(Phase(p)) << std::right
+            << std::setw(12) << h.getCount()
+            << std::setw(12) << h.getPercentile(50) / 1000.0
+            << std::setw(12) << h.getPercentile(99) / 1000.0
+            << std::setw(12) << h.getMax() / 1000.0
+            << std::setw(14) << h.getTotal() / 1000000.0 << '\n';
+    }
+
+    if (lateness.empty()) {
+        return;
+    }
+
+    out << '\n' << std::left << std::setw(20) << "trigger lateness" << std::right
+        << std::setw(12) << "count"
+        << std::setw(12) << "p50 [us]"
+        << std::setw(12) << "p99 [us]"
+        << std::setw(12) << "max [us]"
+        << std::setw(14) << "skipped" << '\n';
+    for (auto & trigger : lateness) {
+        const Histogram & h = trigger.performed;
+        out << std::left << std::setw(20) << trigger.name << std::right
+            << std::setw(12) << h.getCount()
+            << std::setw(12) << h.getPercentile(50) / 1000.0
+            << std::setw(12) << h.getPercentile(99) / 1000.0
+            << std::setw(12) << h.getMax() / 1000.0
+            << std::setw(14) << trigger.skipped << '\n';
+    }
+}
+
+bool Profiler::finish() {
+    if (!enabled) {
+        return true;
+    }
+    enabled = false;
+
+    std::ofstream file(summaryPath);
+    writeSummary(file);
+    return file.good();
+}
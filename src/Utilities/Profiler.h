@@ -0,0 +1,185 @@
+/****************************************************************
+ * @file Profiler.h
+ * @author Michal Dobes
+ * @brief Profiler of phases of game frame
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Structures/Histogram.h"
+
+#define PROFILERENVIRONMENTVARIABLE "DOBESMIC_PROFILE" //< Path to summary file, enables profiler
+
+/**
+ * @brief Profiler of phases of game frame
+ *
+ * Durations of phases are recorded in nanoseconds into histogram of each phase.
+ * When disabled, measuring a phase costs one check of flag.
+ *
+ * Phases may be nested (timer update includes movements performed by triggers),
+ * so durations of phases don't add up to frame time.
+ *
+ * Phases are recorded only from game thread.
+ *
+ * Lateness of timer triggers of finished games is added to summary by name
+ * of trigger.
+ *
+ */
+class Profiler {
+public:
+    /**
+     * @brief Measured phases
+     *
+     */
+    enum Phase : unsigned int {
+        timerUpdate, //< Timer::update, including performed actions
+        movePlayer, //< Game::movePlayer
+        moveEnemy, //< Game::moveEnemy, including planning of ghosts
+        detectCollisions, //< Game::detectCollisions
+        drawGame, //< GameView::draw, when something is drawn
+        screenUpdate, //< Renderer::updateScreen in LayoutView
+        input, //< Reading input while playing, including waiting for it until next change of game
+        phaseCount
+    };
+
+    /**
+     * @brief Measurement of phase from construction to destruction
+     *
+     */
+    class Scope {
+    private:
+        Phase phase; //< Measured phase
+        bool active; //< Profiler was enabled at construction
+        std::chrono::steady_clock::time_point begin; //< Time of construction
+
+    public:
+        /**
+         * @brief Construct a new Scope object and start measuring
+         *
+         * @param measuredPhase phase
+         */
+        Scope(Phase measuredPhase) : phase(measuredPhase), active(Profiler::enabled) {
+            if (active) {
+                begin = std::chrono::steady_clock::now();
+            }
+        }
+
+        /**
+         * @brief Destroy the Scope object and record duration
+         *
+         */
+        ~Scope() {
+            if (active) {
+                Profiler::record(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - begin).count());
+            }
+        }
+
+        Scope(const Scope &) = delete;
+        Scope & operator = (const Scope &) = delete;
+    };
+
+private:
+    /**
+     * @brief Lateness of timer triggers with the same name
+     *
+     */
+    struct TriggerLateness {
+        std::string name; //< Name of triggers
+        Histogram performed; //< Lateness of performances in nanoseconds
+        uint64_t skipped; //< Performances skipped by catch up policy
+    };
+
+    static bool enabled; //< Phases are recorded
+    static std::string summaryPath; //< Path to file for summary
+    static std::array<Histogram, phaseCount> histograms; //< Durations of each phase
+    static std::vector<TriggerLateness> lateness; //< Lateness of triggers by name
+
+public:
+    /**
+     * @brief Enable profiler
+     *
+     * @param path path to file into which summary is written by finish
+     */
+    static void enable(const std::string & path);
+
+    /**
+     * @brief Enable profiler, if environment variable PROFILERENVIRONMENTVARIABLE is set
+     *
+     * @return true profiler is enabled
+     * @return false
+     */
+    static bool enableFromEnvironment();
+
+    /**
+     * @brief Is profiler enabled
+     *
+     * @return true
+     * @return false
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Record duration of phase
+     *
+     * @param phase phase
+     * @param nanoseconds duration
+     */
+    static void record(Phase phase, uint64_t nanoseconds);
+
+    /**
+     * @brief Add lateness of timer triggers, if profiler is enabled
+     *
+     * @param name name of triggers
+     * @param performed lateness of performances in nanoseconds
+     * @param skipped performances skipped by catch up policy
+     */
+    static void recordLateness(const std::string & name, const Histogram & performed, uint64_t skipped);
+
+    /**
+     * @brief Get histogram of phase
+     *
+     * @param phase phase
+     * @return const Histogram& durations in nanoseconds
+     */
+    static const Histogram & getHistogram(Phase phase);
+
+    /**
+     * @brief Get name of phase
+     *
+     * @param phase phase
+     * @return const char*
+     */
+    static const char * phaseName(Phase phase);
+
+    /**
+     * @brief Write summary of all phases (count, p50, p99, max and total duration)
+     * and lateness of triggers (count, p50, p99, max and skipped performances)
+     *
+     * @param out stream to write into
+     */
+    static void writeSummary(std::ostream & out);
+
+    /**
+     * @brief Write summary into file given when enabled and disable profiler
+     *
+     * Nothing is done if profiler is not enabled.
+     *
+     * @return true summary was written or profiler was not enabled
+     * @return false file couldn't be written
+     */
+    static bool finish();
+};
+
+#endif /* PROFILER_H */
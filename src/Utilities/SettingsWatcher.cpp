@@ -0,0 +1,102 @@
+#include <filesystem>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "Utilities/SettingsWatcher.h"
+#include "Utilities/FileManagers/GameSettingsRecordsFileLoader.h"
+
+SettingsWatcher::SettingsWatcher(const std::string & settingsPath)
+    : inotifyFd(-1), wakeFd(-1), stopping(false), failedLoads(0) {
+    std::filesystem::path path(settingsPath);
+    directoryPath = path.has_parent_path() ? path.parent_path().string() : ".";
+    fileName = path.filename().string();
+
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inotifyFd < 0 || wakeFd < 0
+        || inotify_add_watch(inotifyFd, directoryPath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+        }
+        if (wakeFd >= 0) {
+            close(wakeFd);
+        }
+        inotifyFd = -1;
+        wakeFd = -1;
+        return;
+    }
+
+    watcher = std::thread(&SettingsWatcher::watch, this);
+}
+
+SettingsWatcher::~SettingsWatcher() {
+    if (watcher.joinable()) {
+        stopping = true;
+        uint64_t one = 1;
+        if (write(wakeFd, &one, sizeof(one)) < 0) { } //< Thread also wakes up periodically
+        watcher.join();
+    }
+
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+        close(wakeFd);
+    }
+}
+
+void SettingsWatcher::watch() {
+    alignas(inotify_event) char buffer[4096];
+    pollfd fds[2] = { { inotifyFd, POLLIN, 0 }, { wakeFd, POLLIN, 0 } };
+
+    while (!stopping) {
+        if (poll(fds, 2, 1000) <= 0 || !(fds[0].revents & POLLIN)) {
+            continue;
+        }
+
+        // Multiple events of one save are handled by one load
+        bool changed = false;
+        ssize_t length;
+        while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+            for (char * e = buffer; e < buffer + length; e += sizeof(inotify_event) + ((inotify_event *)e)->len) {
+                inotify_event * event = (inotify_event *)e;
+                if (event->len > 0 && fileName == event->name) {
+                    changed = true;
+                }
+            }
+        }
+
+        if (changed) {
+            load();
+        }
+    }
+}
+
+void SettingsWatcher::load() {
+    try {
+        GameSettingsRecordsFileLoader loader(directoryPath + "/" + fileName);
+        GameSettings settings = loader.loadSettingsAndRecords().first;
+
+        std::lock_guard<std::mutex> lock(settingsMutex);
+        loadedSettings = settings;
+    }
+    catch (FileLoaderException & e) {
+        failedLoads++;
+    }
+}
+
+bool SettingsWatcher::isWatching() const {
+    return inotifyFd >= 0;
+}
+
+std::optional<GameSettings> SettingsWatcher::takeSettings() {
+    std::lock_guard<std::mutex> lock(settingsMutex);
+    std::optional<GameSettings> taken;
+    taken.swap(loadedSettings);
+    return taken;
+}
+
+unsigned long SettingsWatcher::getFailedLoads() const {
+    return failedLoads;
+}
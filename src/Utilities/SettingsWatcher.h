@@ -0,0 +1,106 @@
+/****************************************************************
+ * @file SettingsWatcher.h
+ * @author Michal Dobes
+ * @brief Watcher of game settings file
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef SETTINGSWATCHER_H
+#define SETTINGSWATCHER_H
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "Utilities/Contexts/GameSettings.h"
+
+/**
+ * @brief Watcher of game settings file
+ *
+ * Watches directory of settings file using inotify on its own thread. When
+ * the file is written or replaced (editors often save by renaming temporary
+ * file), it is loaded again on the watcher thread. Settings that were loaded
+ * successfully are kept until taken by takeSettings, file that couldn't be
+ * loaded (e.g. while still being written) is ignored.
+ *
+ * If inotify is not available, watcher doesn't report any change.
+ *
+ */
+class SettingsWatcher {
+private:
+    std::string directoryPath; //< Directory containing settings file
+    std::string fileName; //< Name of settings file
+
+    int inotifyFd; //< Inotify instance, -1 if not available
+    int wakeFd; //< Event used to wake watcher thread when stopping
+
+    std::thread watcher; //< Watcher thread
+    std::atomic<bool> stopping; //< Watcher thread should end
+
+    std::mutex settingsMutex; //< Guards loadedSettings
+    std::optional<GameSettings> loadedSettings; //< Settings loaded since last take
+    std::atomic<unsigned long> failedLoads; //< Number of changes that couldn't be loaded
+
+    /**
+     * @brief Loop of watcher thread
+     *
+     */
+    void watch();
+
+    /**
+     * @brief Load settings file and store loaded settings
+     *
+     */
+    void load();
+
+public:
+    /**
+     * @brief Construct a new Settings Watcher object and start watching
+     *
+     * @param settingsPath path to settings file
+     */
+    SettingsWatcher(const std::string & settingsPath);
+
+    /**
+     * @brief Destroy the Settings Watcher object
+     *
+     * Stops and joins watcher thread.
+     *
+     */
+    ~SettingsWatcher();
+
+    SettingsWatcher(const SettingsWatcher &) = delete;
+    SettingsWatcher & operator = (const SettingsWatcher &) = delete;
+
+    /**
+     * @brief Is file being watched
+     *
+     * @return true
+     * @return false inotify is not available
+     */
+    bool isWatching() const;
+
+    /**
+     * @brief Take settings loaded since last call
+     *
+     * Never blocks for loading, only for handing over loaded settings.
+     *
+     * @return std::optional<GameSettings> the latest loaded settings, empty if
+     *      file didn't change or couldn't be loaded
+     */
+    std::optional<GameSettings> takeSettings();
+
+    /**
+     * @brief Get number of changes of file that couldn't be loaded
+     *
+     * @return unsigned long
+     */
+    unsigned long getFailedLoads() const;
+};
+
+#endif /* SETTINGSWATCHER_H */
@@ -0,0 +1,332 @@
+#include <algorithm>
+#include <cstdlib>
+
+#include "Utilities/TerminalScreen.h"
+
+TerminalScreen::TerminalScreen(size_t screenLines, size_t screenColumns)
+    :
+    lines(std::max<size_t>(1, screenLines)),
+    columns(std::max<size_t>(1, screenColumns)),
+    cells(lines, std::vector<Cell>(columns, Cell { ' ', -1 })),
+    cursorLine(0),
+    cursorColumn(0),
+    wrapPending(false),
+    scrollTop(0),
+    scrollBottom(lines - 1),
+    foreground(-1),
+    lastCharacter(' '),
+    state(State::text) { }
+
+void TerminalScreen::put(char c) {
+    if (wrapPending) {
+        cursorColumn = 0;
+        lineFeed();
+        wrapPending = false;
+    }
+
+    cells[cursorLine][cursorColumn] = Cell { c, foreground };
+    writes.push_back(Write { cursorLine, cursorColumn, c, foreground });
+    lastCharacter = c;
+
+    if (cursorColumn + 1 == columns) {
+        wrapPending = true;
+    } else {
+        cursorColumn++;
+    }
+}
+
+void TerminalScreen::lineFeed() {
+    if (cursorLine == scrollBottom) {
+        scrollLines(scrollTop, 1);
+    } else if (cursorLine + 1 < lines) {
+        cursorLine++;
+    }
+}
+
+void TerminalScreen::scrollLines(size_t from, int amount) {
+    // Lines from "from" to bottom of region move, emptied lines are blank
+    if (from < scrollTop || from > scrollBottom) {
+        return;
+    }
+    auto begin = cells.begin() + from;
+    auto end = cells.begin() + scrollBottom + 1;
+    size_t count = std::min<size_t>(std::abs(amount), end - begin);
+    if (amount > 0) {
+        std::rotate(begin, begin + count, end);
+        std::fill(end - count, end, std::vector<Cell>(columns, Cell { ' ', -1 }));
+    } else {
+        std::rotate(begin, end - count, end);
+        std::fill(begin, begin + count, std::vector<Cell>(columns, Cell { ' ', -1 }));
+    }
+}
+
+void TerminalScreen::eraseCells(size_t line, size_t from, size_t to) {
+    to = std::min(to, columns);
+    for (size_t c = from; c < to; c++) {
+        cells[line][c] = Cell { ' ', -1 };
+    }
+}
+
+void TerminalScreen::selectGraphicRendition(const std::vector<int> & values) {
+    if (values.empty()) {
+        foreground = -1;
+        return;
+    }
+
+    for (size_t i = 0; i < values.size(); i++) {
+        int value = values[i];
+        if (value == 0 || value == 39) {
+            foreground = -1;
+        } else if (value >= 30 && value <= 37) {
+            foreground = value - 30;
+        } else if (value >= 90 && value <= 97) {
+            foreground = value - 90 + 8;
+        } else if (value == 38 || value == 48) { //< Extended color, 5;index or 2;r;g;b
+            bool indexed = (i + 1 < values.size() && values[i + 1] == 5);
+            if (value == 38 && indexed && i + 2 < values.size()) {
+                foreground = values[i + 2];
+            }
+            i += indexed ? 2 : 4;
+        }
+    }
+}
+
+void TerminalScreen::controlSequence(char final) {
+    bool privateSequence = !parameters.empty() && (parameters[0] == '?' || parameters[0] == '>');
+
+    std::vector<int> values;
+    std::string numbers = privateSequence ? parameters.substr(1) : parameters;
+    size_t at = 0;
+    while (at <= numbers.size() && !numbers.empty()) {
+        size_t end = numbers.find(';', at);
+        if (end == std::string::npos) {
+            end = numbers.size();
+        }
+        values.push_back(std::atoi(numbers.substr(at, end - at).c_str()));
+        at = end + 1;
+    }
+    if (privateSequence) {
+        return; //< Modes don't change content
+    }
+
+    size_t first = (values.empty() || values[0] <= 0) ? 1 : values[0]; //< Count or 1-based position
+    size_t second = (values.size() < 2 || values[1] <= 0) ? 1 : values[1];
+    int mode = values.empty() ? 0 : values[0];
+
+    if (final != 'm') {
+        wrapPending = false;
+    }
+
+    switch (final) {
+        case 'H':
+        case 'f':
+            cursorLine = std::min(first, lines) - 1;
+            cursorColumn = std::min(second, columns) - 1;
+            break;
+        case 'A':
+            cursorLine -= std::min(first, cursorLine);
+            break;
+        case 'B':
+            cursorLine = std::min(cursorLine + first, lines - 1);
+            break;
+        case 'C':
+            cursorColumn = std::min(cursorColumn + first, columns - 1);
+            break;
+        case 'D':
+            cursorColumn -= std::min(first, cursorColumn);
+            break;
+        case 'E':
+            cursorLine = std::min(cursorLine + first, lines - 1);
+            cursorColumn = 0;
+            break;
+        case 'F':
+            cursorLine -= std::min(first, cursorLine);
+            cursorColumn = 0;
+            break;
+        case 'G':
+        case '`':
+            cursorColumn = std::min(first, columns) - 1;
+            break;
+        case 'd':
+            cursorLine = std::min(first, lines) - 1;
+            break;
+        case 'J':
+            if (mode == 0) {
+                eraseCells(cursorLine, cursorColumn, columns);
+                for (size_t l = cursorLine + 1; l < lines; l++) {
+                    eraseCells(l, 0, columns);
+                }
+            } else if (mode == 1) {
+                eraseCells(cursorLine, 0, cursorColumn + 1);
+                for (size_t l = 0; l < cursorLine; l++) {
+                    eraseCells(l, 0, columns);
+                }
+            } else {
+                for (size_t l = 0; l < lines; l++) {
+                    eraseCells(l, 0, columns);
+                }
+            }
+            break;
+        case 'K':
+            if (mode == 0) {
+                eraseCells(cursorLine, cursorColumn, columns);
+            } else if (mode == 1) {
+                eraseCells(cursorLine, 0, cursorColumn + 1);
+            } else {
+                eraseCells(cursorLine, 0, columns);
+            }
+            break;
+        case 'X':
+            eraseCells(cursorLine, cursorColumn, cursorColumn + first);
+            break;
+        case 'b':
+            for (size_t r = 0; r < first; r++) {
+                put(lastCharacter);
+            }
+            break;
+        case '@': {
+            std::vector<Cell> & line = cells[cursorLine];
+            size_t count = std::min(first, columns - cursorColumn);
+            std::rotate(line.begin() + cursorColumn, line.end() - count, line.end());
+            eraseCells(cursorLine, cursorColumn, cursorColumn + count);
+            break;
+        }
+        case 'P': {
+            std::vector<Cell> & line = cells[cursorLine];
+            size_t count = std::min(first, columns - cursorColumn);
+            std::rotate(line.begin() + cursorColumn, line.begin() + cursorColumn + count, line.end());
+            eraseCells(cursorLine, columns - count, columns);
+            break;
+        }
+        case 'L':
+            scrollLines(cursorLine, -(int)first);
+            break;
+        case 'M':
+            scrollLines(cursorLine, first);
+            break;
+        case 'S':
+            scrollLines(scrollTop, first);
+            break;
+        case 'T':
+            scrollLines(scrollTop, -(int)first);
+            break;
+        case 'r':
+            scrollTop = std::min(first, lines) - 1;
+            scrollBottom = (values.size() < 2 || values[1] <= 0) ? lines - 1 : std::min<size_t>(values[1], lines) - 1;
+            if (scrollTop >= scrollBottom) {
+                scrollTop = 0;
+                scrollBottom = lines - 1;
+            }
+            cursorLine = 0;
+            cursorColumn = 0;
+            break;
+        case 'm':
+            selectGraphicRendition(values);
+            break;
+        default:
+            break;
+    }
+}
+
+void TerminalScreen::feed(const char * data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        char c = data[i];
+
+        switch (state) {
+            case State::text:
+                if (c == '\x1b') {
+                    state = State::escape;
+                } else if (c == '\r') {
+                    cursorColumn = 0;
+                    wrapPending = false;
+                } else if (c == '\n' || c == '\v' || c == '\f') {
+                    lineFeed();
+                    wrapPending = false;
+                } else if (c == '\b') {
+                    cursorColumn -= (cursorColumn > 0) ? 1 : 0;
+                    wrapPending = false;
+                } else if (c == '\t') {
+                    cursorColumn = std::min(((cursorColumn / 8) + 1) * 8, columns - 1);
+                } else if ((unsigned char)c >= ' ' && c != '\x7f') {
+                    put(c);
+                }
+                break;
+            case State::escape:
+                state = State::text;
+                if (c == '[') {
+                    parameters.clear();
+                    state = State::controlSequence;
+                } else if (c == '(' || c == ')') {
+                    state = State::characterSet;
+                } else if (c == ']') {
+                    state = State::operatingSystemCommand;
+                } else if (c == 'M') { //< Reverse index
+                    if (cursorLine == scrollTop) {
+                        scrollLines(scrollTop, -1);
+                    } else if (cursorLine > 0) {
+                        cursorLine--;
+                    }
+                } else if (c == 'D') { //< Index
+                    lineFeed();
+                } else if (c == 'E') { //< Next line
+                    cursorColumn = 0;
+                    lineFeed();
+                }
+                break;
+            case State::controlSequence:
+                if (c >= 0x40 && c <= 0x7e) {
+                    controlSequence(c);
+                    state = State::text;
+                } else {
+                    parameters += c;
+                }
+                break;
+            case State::characterSet:
+                state = State::text;
+                break;
+            case State::operatingSystemCommand:
+                if (c == '\a') {
+                    state = State::text;
+                } else if (c == '\x1b') {
+                    state = State::operatingSystemCommandEscape;
+                }
+                break;
+            case State::operatingSystemCommandEscape:
+                state = (c == '\\') ? State::text : State::operatingSystemCommand;
+                break;
+        }
+    }
+}
+
+std::vector<TerminalScreen::Write> TerminalScreen::takeWrites() {
+    std::vector<Write> taken;
+    taken.swap(writes);
+    return taken;
+}
+
+std::string TerminalScreen::getLine(size_t line) const {
+    std::string text;
+    if (line >= lines) {
+        return text;
+    }
+    for (const Cell & cell : cells[line]) {
+        text += cell.character;
+    }
+    return text;
+}
+
+int TerminalScreen::getForeground(size_t line, size_t column) const {
+    if (line >= lines || column >= columns) {
+        return -1;
+    }
+    return cells[line][column].foreground;
+}
+
+bool TerminalScreen::contains(const std::string & text) const {
+    for (size_t l = 0; l < lines; l++) {
+        if (getLine(l).find(text) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,180 @@
+/****************************************************************
+ * @file TerminalScreen.h
+ * @author Michal Dobes
+ * @brief Model of terminal screen fed by terminal output
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef TERMINALSCREEN_H
+#define TERMINALSCREEN_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Model of terminal screen fed by terminal output
+ *
+ * Interprets output written for xterm (as by ncurses with TERM=xterm-256color):
+ * printable characters, cursor movement, erasing, repetition of character,
+ * insertion and deletion of characters and lines, scrolling region and
+ * foreground color. Other sequences (modes, character sets, titles) are
+ * consumed without effect.
+ *
+ * Every written character is also remembered, so changes of screen can be
+ * followed without comparing whole screens.
+ *
+ */
+class TerminalScreen {
+public:
+    /**
+     * @brief Character written to screen
+     *
+     */
+    struct Write {
+        size_t line; //< Line of character
+        size_t column; //< Column of character
+        char character; //< Written character
+        int foreground; //< Foreground color, -1 for default
+    };
+
+private:
+    /**
+     * @brief Cell of screen
+     *
+     */
+    struct Cell {
+        char character; //< Character in cell
+        int foreground; //< Foreground color, -1 for default
+    };
+
+    /**
+     * @brief State of interpretation of output
+     *
+     */
+    enum class State {
+        text, //< Printable characters and controls
+        escape, //< After ESC
+        controlSequence, //< After ESC [
+        characterSet, //< After ESC ( or ESC ), expecting one character
+        operatingSystemCommand, //< After ESC ], until BEL or ESC
+        operatingSystemCommandEscape //< ESC inside operating system command
+    };
+
+    size_t lines; //< Number of lines
+    size_t columns; //< Number of columns
+    std::vector<std::vector<Cell>> cells; //< Cells by line
+
+    size_t cursorLine; //< Line of cursor
+    size_t cursorColumn; //< Column of cursor
+    bool wrapPending; //< Cursor is past last column, next character wraps
+    size_t scrollTop; //< First line of scrolling region
+    size_t scrollBottom; //< Last line of scrolling region
+    int foreground; //< Current foreground color
+    char lastCharacter; //< Last written character, repeated by REP
+
+    State state; //< State of interpretation
+    std::string parameters; //< Parameters of control sequence read so far
+
+    std::vector<Write> writes; //< Characters written since last takeWrites
+
+    /**
+     * @brief Write printable character at cursor and move cursor
+     *
+     * @param c character
+     */
+    void put(char c);
+
+    /**
+     * @brief Move cursor to next line, scroll region if at its bottom
+     *
+     */
+    void lineFeed();
+
+    /**
+     * @brief Scroll lines of region from line up (positive) or down (negative)
+     *
+     * @param from first line of moved area
+     * @param amount number of lines
+     */
+    void scrollLines(size_t from, int amount);
+
+    /**
+     * @brief Erase cells of line in range
+     *
+     * @param line line
+     * @param from first erased column
+     * @param to column after last erased column
+     */
+    void eraseCells(size_t line, size_t from, size_t to);
+
+    /**
+     * @brief Perform control sequence
+     *
+     * @param final final character of sequence
+     */
+    void controlSequence(char final);
+
+    /**
+     * @brief Set graphic rendition (only foreground color is kept)
+     *
+     * @param values parameters of sequence
+     */
+    void selectGraphicRendition(const std::vector<int> & values);
+
+public:
+    /**
+     * @brief Construct a new, empty Terminal Screen object
+     *
+     * @param screenLines number of lines
+     * @param screenColumns number of columns
+     */
+    TerminalScreen(size_t screenLines, size_t screenColumns);
+
+    /**
+     * @brief Interpret terminal output
+     *
+     * Sequences may be split between calls.
+     *
+     * @param data output
+     * @param size size of output in bytes
+     */
+    void feed(const char * data, size_t size);
+
+    /**
+     * @brief Get characters written since last call
+     *
+     * @return std::vector<Write>
+     */
+    std::vector<Write> takeWrites();
+
+    /**
+     * @brief Get characters of line
+     *
+     * @param line line
+     * @return std::string
+     */
+    std::string getLine(size_t line) const;
+
+    /**
+     * @brief Get foreground color of cell
+     *
+     * @param line line of cell
+     * @param column column of cell
+     * @return int -1 for default color
+     */
+    int getForeground(size_t line, size_t column) const;
+
+    /**
+     * @brief Does any line contain text
+     *
+     * @param text text
+     * @return true
+     * @return false
+     */
+    bool contains(const std::string & text) const;
+};
+
+#endif /* TERMINALSCREEN_H */
@@ -0,0 +1,52 @@
+#include "Utilities/ThreadPool.h"
+
+void ThreadPool::work() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(tasksMutex);
+            tasksCondition.wait(lock, [ this ]() {
+                return stopping || !tasks.empty();
+                });
+
+            if (tasks.empty()) { //< Stopping and no tasks remaining
+                return;
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+ThreadPool::ThreadPool(size_t threads) : stopping(false) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) { //< Number of hardware threads couldn't be detected
+        threads = 1;
+    }
+
+    for (size_t i = 0; i < threads; i++) {
+        workers.emplace_back([ this ]() {
+            this->work();
+            });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        stopping = true;
+    }
+    tasksCondition.notify_all();
+
+    for (auto & w : workers) {
+        w.join();
+    }
+}
+
+size_t ThreadPool::size() const {
+    return workers.size();
+}
@@ -0,0 +1,100 @@
+/****************************************************************
+ * @file ThreadPool.h
+ * @author Michal Dobes
+ * @brief Thread pool utility
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Thread pool
+ *
+ * Keeps fixed number of worker threads, which perform submitted tasks in order
+ * of submission.
+ *
+ * Threads are joined on destruction, after all submitted tasks are performed.
+ *
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers; //< Worker threads
+    std::queue<std::function<void()>> tasks; //< Tasks waiting to be performed
+
+    std::mutex tasksMutex; //< Guards tasks and stopping
+    std::condition_variable tasksCondition; //< Signals new task or stopping
+    bool stopping; //< Workers should end after remaining tasks
+
+    /**
+     * @brief Loop of worker thread
+     *
+     */
+    void work();
+
+public:
+    /**
+     * @brief Construct a new Thread Pool object
+     *
+     * @param threads number of worker threads, if 0 number of hardware threads is used
+     */
+    ThreadPool(size_t threads = 0);
+
+    /**
+     * @brief Destroy the Thread Pool object
+     *
+     * Waits for all submitted tasks to be performed.
+     *
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator = (const ThreadPool &) = delete;
+
+    /**
+     * @brief Submit task to be performed by worker thread
+     *
+     * @tparam F type of callable without parameters
+     * @param task task to perform
+     * @return std::future future with result of task (exception thrown by task
+     *      is stored in future)
+     */
+    template <typename F>
+    std::future<std::invoke_result_t<F>> submit(F task) {
+        typedef std::invoke_result_t<F> Result;
+
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(tasksMutex);
+            tasks.emplace([ packaged ]() {
+                (*packaged)();
+                });
+        }
+        tasksCondition.notify_one();
+
+        return result;
+    }
+
+    /**
+     * @brief Get number of worker threads
+     *
+     * @return size_t
+     */
+    size_t size() const;
+};
+
+#endif /* THREADPOOL_H */
@@ -1,20 +1,36 @@
+#include <cstring>
+
 #include "Utilities/Timer.h"
+#include "Utilities/Tracer.h"
 
 // SECTION: TimerObject
 Timer::TimerObject::TimerObject(
+    TriggerId triggerId,
     timepoint initTime,
     milliseconds perDur,
-    std::function<void()> act, bool repeat)
+    std::function<void()> act,
+    bool repeat,
+    const char * triggerName,
+    CatchUp catchUpPolicy,
+    size_t latenessIndex)
     :
+    id(triggerId),
     initializeTime(initTime),
     periodDuration(perDur),
     action(act),
-    isRepeatingAction(repeat) {
+    isRepeatingAction(repeat),
+    name(triggerName),
+    catchUp(catchUpPolicy),
+    lateness(latenessIndex) {
     if (perDur.count() == 0 && repeat) {
         throw std::invalid_argument("Timer::TimerObject: TimerObject - repeating action with 0 period");
     }
 }
 
+Timer::TriggerId Timer::TimerObject::getId() const {
+    return id;
+}
+
 Timer::milliseconds Timer::TimerObject::getPeriodDuration() const {
     return periodDuration;
 }
@@ -27,6 +43,18 @@ std::function<void()> Timer::TimerObject::getAction() const {
     return action;
 }
 
+const char * Timer::TimerObject::getName() const {
+    return name;
+}
+
+Timer::CatchUp Timer::TimerObject::getCatchUp() const {
+    return catchUp;
+}
+
+size_t Timer::TimerObject::getLateness() const {
+    return lateness;
+}
+
 Timer::timepoint Timer::TimerObject::actionTime() const {
     return (initializeTime + periodDuration);
 }
@@ -43,6 +71,13 @@ void Timer::TimerObject::updateBeginning(timepoint to) {
     initializeTime = to;
 }
 
+void Timer::TimerObject::updatePeriod(milliseconds to) {
+    if (to.count() == 0 && isRepeatingAction) {
+        throw std::invalid_argument("Timer::TimerObject: updatePeriod - repeating action with 0 period");
+    }
+    periodDuration = to;
+}
+
 bool Timer::TimerObject::operator < (const TimerObject & rhs) const {
     return rhs.actionTime() < actionTime();
 }
@@ -51,7 +86,31 @@ bool Timer::TimerObject::operator < (const TimerObject & rhs) const {
 
 
 // SECTION: Timer
-Timer::Timer() : paused(true), lastPausedTime(Timer::clock::now()) { }
+Timer::timepoint Timer::now() const {
+    if (manual) {
+        return manualTime;
+    }
+    return Timer::clock::now();
+}
+
+Timer::Timer(bool manualClock)
+    :
+    manual(manualClock),
+    manualTime(Timer::clock::now()),
+    paused(true),
+    lastPausedTime(manualTime),
+    nextId(0) { }
+
+bool Timer::isManual() const {
+    return manual;
+}
+
+void Timer::advance(unsigned int milliseconds) {
+    if (!manual) {
+        throw std::logic_error("Timer: advance - timer doesn't use manual clock");
+    }
+    manualTime += Timer::milliseconds(milliseconds);
+}
 
 bool Timer::isPaused() {
     return paused;
@@ -59,19 +118,15 @@ bool Timer::isPaused() {
 
 void Timer::togglePause() {
     if (!paused) {
-        lastPausedTime = Timer::clock::now();
+        lastPausedTime = now();
     } else {
         std::priority_queue<TimerObject> newQueue;
 
         while (!timerQueue.empty()) {
             const TimerObject & originalObject = timerQueue.top();
-            Timer::milliseconds timePassedInObject = std::chrono::duration_cast<Timer::milliseconds>(
-                lastPausedTime - originalObject.getBeginTime());
-            Timer::TimerObject newObject(
-                Timer::clock::now() - timePassedInObject,
-                originalObject.getPeriodDuration(),
-                originalObject.getAction(),
-                originalObject.repeating());
+            Timer::TimerObject newObject(originalObject);
+            // Whole time passed is kept (not only milliseconds), so schedule of repeating triggers is kept exactly
+            newObject.updateBeginning(now() - (lastPausedTime - originalObject.getBeginTime()));
             newQueue.push(newObject);
             timerQueue.pop();
         }
@@ -82,27 +137,165 @@ void Timer::togglePause() {
     paused = !paused;
 }
 
-void Timer::update() {
+std::optional<unsigned int> Timer::timeToNextTrigger() {
+    if (paused || timerQueue.empty()) {
+        return { };
+    }
+
+    clock::duration remaining = timerQueue.top().actionTime() - now();
+    if (remaining <= clock::duration::zero()) {
+        return 0;
+    }
+    return std::chrono::duration_cast<milliseconds>(remaining).count();
+}
+
+size_t Timer::update(bool singleTime, std::optional<timepoint> until) {
     if (paused) {
-        return;
+        return 0;
     }
 
-    while ((timerQueue.size() != 0) && (timerQueue.top().actionTime() <= Timer::clock::now())) {
+    // Time is taken once, so triggers repeating faster than their actions take can't loop forever
+    timepoint current = until ? *until : now();
+    size_t due = 0;
+
+    while ((timerQueue.size() != 0) && (timerQueue.top().actionTime() <= current)) {
+        if (singleTime && performedTime && timerQueue.top().actionTime() != *performedTime) {
+            break;
+        }
+
         Timer::TimerObject copy(timerQueue.top());
         timerQueue.pop();
 
-        copy.callAction();
+        timepoint planned = copy.actionTime();
+        clock::duration late = current - planned;
+        bool missedPeriod = copy.repeating() && late >= copy.getPeriodDuration();
+
+        performedTime = planned;
+        due++;
+        if (copy.getCatchUp() == CatchUp::skip && missedPeriod) {
+            lateness[copy.getLateness()].skipped++;
+        } else {
+            lateness[copy.getLateness()].performed.record(std::chrono::duration_cast<std::chrono::nanoseconds>(late).count());
+
+            if (Tracer::isEnabled()) {
+                Tracer::clock::time_point begin = Tracer::clock::now();
+                copy.callAction();
+                Tracer::complete("timer", copy.getName(), begin, Tracer::clock::now(), "late_us",
+                    std::chrono::duration_cast<std::chrono::microseconds>(late).count());
+            } else {
+                copy.callAction();
+            }
+        }
 
         if (copy.repeating()) {
-            copy.updateBeginning(Timer::clock::now());
+            if (copy.getCatchUp() != CatchUp::all && missedPeriod) {
+                // Continue with the first planned time after now, missed periods are counted as skipped
+                auto periods = late / copy.getPeriodDuration();
+                lateness[copy.getLateness()].skipped += periods;
+                planned += periods * copy.getPeriodDuration();
+            }
+            copy.updateBeginning(planned);
             timerQueue.push(copy);
         }
     }
+
+    performedTime.reset();
+    return due;
 }
 
-void Timer::addTrigger(unsigned int period, std::function<void()> action, bool repeating) {
-    TimerObject newObject(Timer::clock::now(), Timer::milliseconds(period), action, repeating);
+size_t Timer::skipMissed() {
+    if (paused) {
+        return 0;
+    }
+
+    timepoint current = now();
+    std::vector<TimerObject> objects;
+    objects.reserve(timerQueue.size());
+    size_t skipped = 0;
+    while (!timerQueue.empty()) {
+        TimerObject object(timerQueue.top());
+        timerQueue.pop();
+
+        if (object.repeating() && object.actionTime() <= current) {
+            // Planned time is moved by whole periods, so schedule is kept
+            auto periods = (current - object.actionTime()) / object.getPeriodDuration() + 1;
+            lateness[object.getLateness()].skipped += periods;
+            skipped += periods;
+            object.updateBeginning(object.getBeginTime() + periods * object.getPeriodDuration());
+        }
+        objects.push_back(object);
+    }
+
+    timerQueue = std::priority_queue<TimerObject>(objects.begin(), objects.end());
+    return skipped;
+}
+
+Timer::TriggerId Timer::addTrigger(
+    unsigned int period,
+    std::function<void()> action,
+    bool repeating,
+    const char * name,
+    CatchUp catchUp) {
+    TimerObject newObject(
+        nextId,
+        performedTime ? *performedTime : now(),
+        Timer::milliseconds(period),
+        action,
+        repeating,
+        name,
+        catchUp,
+        latenessOf(name));
 
     timerQueue.push(newObject);
+    return nextId++;
+}
+
+bool Timer::setPeriod(TriggerId trigger, unsigned int period) {
+    // Priority queue can't be changed in place, it is rebuilt (changes are rare)
+    std::vector<TimerObject> objects;
+    objects.reserve(timerQueue.size());
+    while (!timerQueue.empty()) {
+        objects.push_back(timerQueue.top());
+        timerQueue.pop();
+    }
+
+    bool found = false;
+    try {
+        for (auto & object : objects) {
+            if (object.getId() == trigger) {
+                object.updatePeriod(Timer::milliseconds(period));
+                found = true;
+            }
+        }
+    }
+    catch (std::invalid_argument & e) {
+        timerQueue = std::priority_queue<TimerObject>(objects.begin(), objects.end());
+        throw;
+    }
+
+    timerQueue = std::priority_queue<TimerObject>(objects.begin(), objects.end());
+    return found;
+}
+
+size_t Timer::latenessOf(const char * name) {
+    for (size_t i = 0; i < lateness.size(); i++) {
+        if (lateness[i].name == name || std::strcmp(lateness[i].name, name) == 0) {
+            return i;
+        }
+    }
+    lateness.push_back(Lateness { name, Histogram(), 0 });
+    return lateness.size() - 1;
+}
+
+const std::vector<Timer::Lateness> & Timer::getLateness() const {
+    return lateness;
+}
+
+void Timer::mergeLateness(const Timer & other) {
+    for (auto & otherLateness : other.lateness) {
+        Lateness & own = lateness[latenessOf(otherLateness.name)];
+        own.performed.merge(otherLateness.performed);
+        own.skipped += otherLateness.skipped;
+    }
 }
 //!SECTION: Timer
@@ -13,9 +13,13 @@
 
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <queue>
 #include <deque>
 #include <stdexcept>
+#include <vector>
+
+#include "Structures/Histogram.h"
 
 /**
  * @brief Timer
@@ -25,14 +29,47 @@
  *
  * Supports pausing.
  *
+ * Timer can use manual clock instead of system clock, time of manual clock
+ * moves only when advanced (used for deterministic stepping without real time).
+ *
+ * Repeating triggers keep their ideal schedule (n-th performance is planned at
+ * n periods after addition), so lateness of updates doesn't accumulate. When
+ * update is late by whole periods, catch up policy of trigger decides, whether
+ * missed performances are performed.
+ *
+ * Lateness of each performance is recorded into histogram of trigger name.
+ *
  */
 class Timer {
-private:
+public:
     // Typedef long names
     typedef std::chrono::steady_clock clock;
     typedef std::chrono::time_point<clock> timepoint;
     typedef std::chrono::milliseconds milliseconds;
 
+    typedef size_t TriggerId; //< Identifier of trigger, unique in timer
+
+    /**
+     * @brief Policy of repeating trigger for performances missed by late update
+     *
+     */
+    enum class CatchUp {
+        all, //< Perform all missed performances, in order
+        once, //< Perform once, continue with the next planned performance after now
+        skip //< Perform only if late by less than period, continue with the next planned performance after now
+    };
+
+    /**
+     * @brief Lateness of performances of triggers with the same name
+     *
+     */
+    struct Lateness {
+        const char * name; //< Name of triggers
+        Histogram performed; //< Lateness of performances in nanoseconds
+        uint64_t skipped; //< Performances not performed due to catch up policy
+    };
+
+private:
     /**
      * @brief Timer action object.
      *
@@ -41,23 +78,46 @@ private:
      */
     class TimerObject {
     private:
+        TriggerId id; //< Identifier of trigger
         timepoint initializeTime; //< Time of initialization
         milliseconds periodDuration; //< Period time for action after initialization
 
         std::function<void()> action; //< Action to perform
         bool isRepeatingAction; //< Should repeat after performing action
+        const char * name; //< Name of trigger in trace
+        CatchUp catchUp; //< Policy for missed performances
+        size_t lateness; //< Index of lateness of trigger in timer
 
     public:
 
         /**
          * @brief Construct a new Timer Object object
          *
+         * @param triggerId Identifier of trigger
          * @param initTime Time of initialization
          * @param perDur Milliseconds, after which to perform action
          * @param act Action to perform
          * @param repeat Repeat after performing action
+         * @param triggerName Name of trigger in trace
+         * @param catchUpPolicy Policy for missed performances
+         * @param latenessIndex Index of lateness of trigger in timer
+         */
+        TimerObject(
+            TriggerId triggerId,
+            timepoint initTime,
+            milliseconds perDur,
+            std::function<void()> act,
+            bool repeat,
+            const char * triggerName,
+            CatchUp catchUpPolicy,
+            size_t latenessIndex);
+
+        /**
+         * @brief Get identifier of trigger
+         *
+         * @return TriggerId
          */
-        TimerObject(timepoint initTime, milliseconds perDur, std::function<void()> act, bool repeat);
+        TriggerId getId() const;
 
         /**
          * @brief Get milliseconds from initalization time, after which to perform action
@@ -80,6 +140,27 @@ private:
          */
         std::function<void()> getAction() const;
 
+        /**
+         * @brief Get name of trigger in trace
+         *
+         * @return const char*
+         */
+        const char * getName() const;
+
+        /**
+         * @brief Get policy for missed performances
+         *
+         * @return CatchUp
+         */
+        CatchUp getCatchUp() const;
+
+        /**
+         * @brief Get index of lateness of trigger in timer
+         *
+         * @return size_t
+         */
+        size_t getLateness() const;
+
         /**
          * @brief Get time at which to perform action
          *
@@ -109,6 +190,15 @@ private:
          */
         void updateBeginning(timepoint to);
 
+        /**
+         * @brief Change period after initialization time
+         *
+         * @throws std::invalid_argument repeating action with 0 period
+         *
+         * @param to new period
+         */
+        void updatePeriod(milliseconds to);
+
         /**
          * @brief Comparison operator for priority queue
          *
@@ -122,19 +212,61 @@ private:
     };
 
 private:
+    bool manual; //< Uses manual clock
+    timepoint manualTime; //< Current time of manual clock
+
     bool paused;
     timepoint lastPausedTime; //< Time when was paused
 
     std::priority_queue<TimerObject> timerQueue; //< Priority queue of triggers
+    TriggerId nextId; //< Identifier of next added trigger
 
+    std::optional<timepoint> performedTime; //< Planned time of currently performed trigger,
+    // triggers added by its action are timed from it
+    std::vector<Lateness> lateness; //< Lateness of triggers by name
+
+    /**
+     * @brief Get index of lateness of triggers with name, add it if needed
+     *
+     * @param name name of trigger
+     * @return size_t
+     */
+    size_t latenessOf(const char * name);
 
 public:
 
     /**
      * @brief Construct a new Timer object
      *
+     * @param manualClock use manual clock, which moves only using advance
+     */
+    Timer(bool manualClock = false);
+
+    /**
+     * @brief Is timer using manual clock
+     *
+     * @return true
+     * @return false
+     */
+    bool isManual() const;
+
+    /**
+     * @brief Get current time of used clock
+     *
+     * @return timepoint
      */
-    Timer();
+    timepoint now() const;
+
+    /**
+     * @brief Move manual clock forward
+     *
+     * Triggers are not performed, update needs to be called after.
+     *
+     * @throws std::logic_error if timer doesn't use manual clock
+     *
+     * @param milliseconds milliseconds to move clock by
+     */
+    void advance(unsigned int milliseconds);
 
     /**
      * @brief Is timer paused
@@ -152,24 +284,96 @@ public:
      */
     void togglePause();
 
+    /**
+     * @brief Get time until planned time of earliest trigger
+     *
+     * @return std::optional<unsigned int> milliseconds, rounded down (0 if trigger
+     * is due), empty if timer is paused or has no triggers
+     */
+    std::optional<unsigned int> timeToNextTrigger();
+
     /**
      * @brief Update timer
      *
      * @warning Should be called periodically.
      *
-     * Performs all triggers that should be perofrmed by now.
+     * Performs all triggers that should be perofrmed by now, in order of their
+     * planned times. Repeating triggers are planned again a period after their
+     * planned (not actual) time, missed performances follow their catch up policy.
      *
+     * If Tracer is enabled, each performed trigger is traced with its lateness
+     * (time between scheduled and actual performance, in microseconds of clock
+     * of timer).
+     *
+     * @param singleTime perform only triggers planned at the earliest planned time,
+     * so caller can react between performances missed by late update
+     * @param until perform triggers planned up to this time instead of now, repeated
+     * single time updates up to time taken once end even if actions take longer than
+     * their periods
+     * @return size_t number of triggers whose planned time came (performed or skipped)
+     */
+    size_t update(bool singleTime = false, std::optional<timepoint> until = std::nullopt);
+
+    /**
+     * @brief Give up performances of repeating triggers missed until now
+     *
+     * Each repeating trigger that is due continues with its first planned time
+     * after now, missed performances are counted as skipped. Used when
+     * catching up takes too long.
+     *
+     * @return size_t number of skipped performances
      */
-    void update();
+    size_t skipMissed();
 
     /**
      * @brief Add new trigger
      *
+     * When called from action of performed trigger, milliseconds are counted
+     * from planned time of performed trigger, so chained triggers don't drift.
+     *
      * @param milliseconds milliseconds after current time to perform action
      * @param action action to perform
      * @param repeating repeat after performing action
+     * @param name name of trigger in trace and lateness, needs to live as long as timer (string literal)
+     * @param catchUp policy for performances of repeating trigger missed by late update
+     * @return TriggerId identifier of trigger
+     */
+    TriggerId addTrigger(
+        unsigned int milliseconds,
+        std::function<void()> action,
+        bool repeating = false,
+        const char * name = "trigger",
+        CatchUp catchUp = CatchUp::once);
+
+    /**
+     * @brief Change period of trigger
+     *
+     * Trigger is performed the new period after it was added or last performed,
+     * if that time already passed, it is performed at next update. Following
+     * repetitions use the new period.
+     *
+     * @throws std::invalid_argument repeating trigger with 0 period
+     *
+     * @param trigger identifier of trigger
+     * @param milliseconds new period
+     * @return true period was changed
+     * @return false trigger doesn't exist (it was performed and doesn't repeat)
+     */
+    bool setPeriod(TriggerId trigger, unsigned int milliseconds);
+
+    /**
+     * @brief Get lateness of triggers, by name of trigger
+     *
+     * @return const std::vector<Lateness>&
+     */
+    const std::vector<Lateness> & getLateness() const;
+
+    /**
+     * @brief Add lateness recorded by other timer (used to keep lateness over replaced timer)
+     *
+     * @param other timer
      */
-    void addTrigger(unsigned int milliseconds, std::function<void()> action, bool repeating = false);
+    void mergeLateness(const Timer & other);
 
 };
 #endif /* TIMER_H */
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cstdlib>
+
+#include "Utilities/Tracer.h"
+
+std::atomic<bool> Tracer::enabled(false);
+std::mutex Tracer::ringsMutex;
+std::vector<std::unique_ptr<Tracer::Ring>> Tracer::rings;
+std::ofstream Tracer::file;
+bool Tracer::firstWritten = false;
+Tracer::clock::time_point Tracer::origin;
+std::thread Tracer::flusher;
+std::condition_variable Tracer::flusherCondition;
+bool Tracer::stopping = false;
+
+namespace {
+    /**
+     * @brief Convert duration to microseconds for trace
+     *
+     * @param duration duration
+     * @return double
+     */
+    double toMicroseconds(Tracer::clock::duration duration) {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+}
+
+Tracer::Ring & Tracer::threadRing() {
+    thread_local Ring * ring = nullptr;
+    if (ring == nullptr) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(std::make_unique<Ring>(rings.size() + 1));
+        ring = rings.back().get();
+    }
+    return *ring;
+}
+
+void Tracer::push(const Event & event) {
+    Ring & ring = threadRing();
+
+    size_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) == Ring::capacity) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ring.events[head & (Ring::capacity - 1)] = event;
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::flush() {
+    for (auto & ring : rings) {
+        size_t tail = ring->tail.load(std::memory_order_relaxed);
+        size_t head = ring->head.load(std::memory_order_acquire);
+
+        for (; tail != head; tail++) {
+            const Event & event = ring->events[tail & (Ring::capacity - 1)];
+
+            file << (firstWritten ? ",\n" : "")
+                << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << '"'
+                << ",\"pid\":1,\"tid\":" << ring->thread
+                << ",\"ts\":" << toMicroseconds(event.begin - origin);
+            if (event.duration.count() < 0) {
+                file << ",\"ph\":\"i\",\"s\":\"t\"";
+            } else {
+                file << ",\"ph\":\"X\",\"dur\":" << toMicroseconds(event.duration);
+            }
+            if (event.argumentName != nullptr) {
+                file << ",\"args\":{\"" << event.argumentName << "\":" << event.argument << '}';
+            }
+            file << '}';
+            firstWritten = true;
+        }
+
+        ring->tail.store(tail, std::memory_order_release);
+    }
+    file.flush();
+}
+
+void Tracer::flushPeriodically() {
+    std::unique_lock<std::mutex> lock(ringsMutex);
+    while (!stopping) {
+        flusherCondition.wait_for(lock, std::chrono::milliseconds(TRACERFLUSHPERIOD));
+        flush();
+    }
+}
+
+bool Tracer::enable(const std::string & path) {
+    if (isEnabled()) {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        file.open(path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"dobesmic\"}}";
+        firstWritten = true;
+        origin = clock::now();
+        stopping = false;
+    }
+
+    flusher = std::thread(&Tracer::flushPeriodically);
+    enabled = true;
+    return true;
+}
+
+bool Tracer::enableFromEnvironment() {
+    const char * path = std::getenv(TRACERENVIRONMENTVARIABLE);
+    if (path != nullptr && *path != '\0') {
+        return enable(path);
+    }
+    return false;
+}
+
+void Tracer::complete(
+    const char * category,
+    const char * name,
+    clock::time_point begin,
+    clock::time_point end,
+    const char * argumentName,
+    int64_t argument) {
+    if (!isEnabled()) {
+        return;
+    }
+    push(Event { category, name, argumentName, argument, begin, std::max(end - begin, clock::duration::zero()) });
+}
+
+void Tracer::instant(const char * category, const char * name) {
+    if (!isEnabled()) {
+        return;
+    }
+    push(Event { category, name, nullptr, 0, clock::now(), clock::duration(-1) });
+}
+
+bool Tracer::finish() {
+    if (!isEnabled()) {
+        return true;
+    }
+    enabled = false;
+
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        stopping = true;
+    }
+    flusherCondition.notify_all();
+    flusher.join();
+
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    flush();
+
+    uint64_t dropped = 0;
+    for (auto & ring : rings) {
+        dropped += ring->dropped.exchange(0);
+    }
+    file << ",\n{\"name\":\"dropped events\",\"ph\":\"M\",\"pid\":1,\"args\":{\"count\":" << dropped << "}}";
+    file << "\n]}\n";
+
+    bool success = file.good();
+    file.close();
+    return success;
+}
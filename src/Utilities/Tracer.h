@@ -0,0 +1,224 @@
+/****************************************************************
+ * @file Tracer.h
+ * @author Michal Dobes
+ * @brief Trace event recorder
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define TRACERENVIRONMENTVARIABLE "DOBESMIC_TRACE" //< Path to trace file, enables tracer
+#define TRACERRINGBITS 12 //< Ring buffer of each thread has 2^bits events
+#define TRACERFLUSHPERIOD 50 //< Milliseconds between flushes of ring buffers
+
+/**
+ * @brief Trace event recorder
+ *
+ * Records events into file in Chrome trace event format (JSON), which can be
+ * opened in chrome://tracing or Perfetto UI.
+ *
+ * Each thread writes its events into its own ring buffer without locking
+ * (only the first event of thread registers its buffer). Buffers are emptied
+ * into file by background thread. When buffer is full, events are dropped
+ * and their count is written at the end of trace.
+ *
+ * Names and categories of events need to be string literals (or other strings
+ * that live until the tracer is finished), only pointers are stored.
+ *
+ */
+class Tracer {
+public:
+    typedef std::chrono::steady_clock clock;
+
+    /**
+     * @brief Event that lasts from construction to destruction of scope
+     *
+     */
+    class Scope {
+    private:
+        const char * category; //< Category of event
+        const char * name; //< Name of event
+        bool active; //< Tracer was enabled at construction
+        clock::time_point begin; //< Time of construction
+
+    public:
+        /**
+         * @brief Construct a new Scope object and start event
+         *
+         * @param eventCategory category of event
+         * @param eventName name of event
+         */
+        Scope(const char * eventCategory, const char * eventName)
+            : category(eventCategory), name(eventName), active(Tracer::isEnabled()) {
+            if (active) {
+                begin = clock::now();
+            }
+        }
+
+        /**
+         * @brief Destroy the Scope object and record event
+         *
+         */
+        ~Scope() {
+            if (active) {
+                Tracer::complete(category, name, begin, clock::now());
+            }
+        }
+
+        Scope(const Scope &) = delete;
+        Scope & operator = (const Scope &) = delete;
+    };
+
+private:
+    /**
+     * @brief Recorded event
+     *
+     */
+    struct Event {
+        const char * category; //< Category of event
+        const char * name; //< Name of event
+        const char * argumentName; //< Name of argument, nullptr if event has none
+        int64_t argument; //< Value of argument
+        clock::time_point begin; //< Time of beginning
+        clock::duration duration; //< Duration, negative for instant event
+    };
+
+    /**
+     * @brief Single producer, single consumer ring of events of one thread
+     *
+     */
+    struct Ring {
+        static constexpr size_t capacity = (size_t)1 << TRACERRINGBITS; //< Maximal number of events
+
+        std::array<Event, capacity> events; //< Events, indexed by position modulo capacity
+        std::atomic<size_t> head; //< Position of next written event, moved by producer
+        std::atomic<size_t> tail; //< Position of next read event, moved by consumer
+        std::atomic<uint64_t> dropped; //< Events dropped because ring was full
+        unsigned int thread; //< Number of thread in trace
+
+        Ring(unsigned int threadNumber) : head(0), tail(0), dropped(0), thread(threadNumber) { }
+    };
+
+    static std::atomic<bool> enabled; //< Events are recorded
+
+    static std::mutex ringsMutex; //< Guards rings, file and stopping
+    static std::vector<std::unique_ptr<Ring>> rings; //< Rings of all threads that recorded,
+    // kept until program ends, so threads never lose their ring
+    static std::ofstream file; //< Trace file
+    static bool firstWritten; //< Some event was written into file
+    static clock::time_point origin; //< Time of zero in trace
+
+    static std::thread flusher; //< Background thread emptying rings
+    static std::condition_variable flusherCondition; //< Signals stopping of flusher
+    static bool stopping; //< Flusher should end
+
+    /**
+     * @brief Get ring of current thread, register it if needed
+     *
+     * @return Ring&
+     */
+    static Ring & threadRing();
+
+    /**
+     * @brief Put event into ring of current thread
+     *
+     * @param event event
+     */
+    static void push(const Event & event);
+
+    /**
+     * @brief Write events from all rings into file
+     *
+     * ringsMutex needs to be locked.
+     *
+     */
+    static void flush();
+
+    /**
+     * @brief Loop of flusher thread
+     *
+     */
+    static void flushPeriodically();
+
+public:
+    /**
+     * @brief Start recording into file
+     *
+     * @param path path to trace file
+     * @return true file was opened
+     * @return false file couldn't be opened, tracer is not enabled
+     */
+    static bool enable(const std::string & path);
+
+    /**
+     * @brief Start recording, if environment variable TRACERENVIRONMENTVARIABLE is set
+     *
+     * @return true tracer is enabled
+     * @return false
+     */
+    static bool enableFromEnvironment();
+
+    /**
+     * @brief Is tracer enabled
+     *
+     * @return true
+     * @return false
+     */
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record event with duration
+     *
+     * @param category category of event
+     * @param name name of event
+     * @param begin time of beginning
+     * @param end time of end
+     * @param argumentName name of argument, nullptr if event has none
+     * @param argument value of argument
+     */
+    static void complete(
+        const char * category,
+        const char * name,
+        clock::time_point begin,
+        clock::time_point end,
+        const char * argumentName = nullptr,
+        int64_t argument = 0);
+
+    /**
+     * @brief Record event without duration
+     *
+     * @param category category of event
+     * @param name name of event
+     */
+    static void instant(const char * category, const char * name);
+
+    /**
+     * @brief Stop recording, write remaining events and close file
+     *
+     * Nothing is done if tracer is not enabled.
+     *
+     * @return true file was written or tracer was not enabled
+     * @return false file couldn't be written
+     */
+    static bool finish();
+};
+
+#endif /* TRACER_H */
@@ -1,10 +1,12 @@
+#include <algorithm>
 #include <filesystem>
 
 #include "ViewControllers/GameViewController.h"
 #include "Utilities/Contexts/GameControl.h"
+#include "Utilities/Contexts/MapIndex.h"
 #include "Utilities/FileManagers/GameSettingsRecordsFileLoader.h"
-#include "Utilities/FileManagers/GameSettingsRecordsFileSaver.h"
 #include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/Profiler.h"
 #include "Views/SecondaryViews/GameDetailView.h"
 #include "Views/SecondaryViews/OptionMenuView.h"
 #include "Views/SecondaryViews/SettingsView.h"
@@ -16,14 +18,19 @@
 #define SETTINGSEXTENSION ".spac"
 #define MAPSPATH "./examples/Maps/"
 #define MAPSEXTENSION ".mpac"
+#define MAPSBINARYEXTENSION ".mpacb"
 
 #define EASYDIFFICULTYHP 5
 #define MEDIUMDIFFICULTYHP 3
 #define HARDDIFFICULTYHP 1
+#define EXPERTDIFFICULTYHP 1
 
 #define EASYSPEEDMODIF 2
 #define MEDIUMSPEEDMODIF 1.5
 #define HARDSPEEDMODIF 1.1
+#define EXPERTSPEEDMODIF 1.1
+
+#define INPUTIDLETIMEOUT 100 //< Most milliseconds to wait for input while playing
 
 
 bool GameViewController::handleStateExitKey(int c) {
@@ -35,27 +42,53 @@ bool GameViewController::handleStateExitKey(int c) {
     return false;
 }
 
-void GameViewController::createMenuWithFiles(const std::string & filePath, const std::string & extension) {
+void GameViewController::createMenuWithFiles(const std::string & filePath, const std::vector<std::string> & extensions) {
     menu.reset(new OptionMenu());
 
     try {
-        // Add each file in directory with extension as option in menu
+        // Add each file in directory with one of extensions as option in menu
         for (const auto & file : std::filesystem::directory_iterator(filePath)) {
-            if (file.path().extension() == extension) {
+            if (std::find(extensions.begin(), extensions.end(), file.path().extension()) != extensions.end()) {
                 menu->addOption(file.path().filename());
             }
         }
-        layoutView.setSecondaryView(OptionMenuView(menu.get()));
+        layoutView.emplaceSecondaryView<OptionMenuView>(menu.get());
+    }
+    catch (std::filesystem::filesystem_error & e) { // If problem with directory, set warning
+        layoutView.emplaceSecondaryView<SettingsView>(false).setWarning(true, "Couldn't open directory!");
+        return;
+    }
+
+    if (menu->size() == 0) { // If directory empty, set warning
+        layoutView.emplaceSecondaryView<SettingsView>(false).setWarning(true, "No file found!");
+    }
+}
+
+void GameViewController::createMenuWithMaps() {
+    menu.reset(new OptionMenu());
+
+    try {
+        // Maps are described by index, only new or changed files are loaded
+        MapIndex index(MAPSPATH);
+        index.update({ MAPSEXTENSION, MAPSBINARYEXTENSION });
+
+        for (auto & entry : index.getEntries()) {
+            std::string detail = "invalid map";
+            if (entry.valid) {
+                detail = std::to_string(entry.sizeX) + "x" + std::to_string(entry.sizeY)
+                    + ", " + std::to_string(entry.coins) + " coins";
+            }
+            menu->addOption(entry.name, detail);
+        }
+        layoutView.emplaceSecondaryView<OptionMenuView>(menu.get());
     }
     catch (std::filesystem::filesystem_error & e) { // If problem with directory, set warning
-        layoutView.setSecondaryView(SettingsView(false));
-        layoutView.getSecondaryView()->setWarning(true, "Couldn't open directory!");
+        layoutView.emplaceSecondaryView<SettingsView>(false).setWarning(true, "Couldn't open directory!");
         return;
     }
 
     if (menu->size() == 0) { // If directory empty, set warning
-        layoutView.setSecondaryView(SettingsView(false));
-        layoutView.getSecondaryView()->setWarning(true, "No file found!");
+        layoutView.emplaceSecondaryView<SettingsView>(false).setWarning(true, "No file found!");
     }
 }
 
@@ -78,7 +111,7 @@ void GameViewController::updateDifficultyChoosing() {
 
     // Prepare next phase
     phase = settingsLoading;
-    createMenuWithFiles(SETTINGSPATH, SETTINGSEXTENSION);
+    createMenuWithFiles(SETTINGSPATH, { SETTINGSEXTENSION });
     layoutView.getSecondaryView()->setTitle("CHOOSE SETTINGS FILE");
 }
 
@@ -100,32 +133,26 @@ void GameViewController::updateSettingsLoading() {
 
     try {
         GameSettingsRecordsFileLoader gameSettingsLoader(settingsPath);
-        unsigned int hp = 0;
-        double speedModif = 0.0;
         // Different values based on selected difficulty
-        switch (loadedDifficulty) {
-            case 0:
-                hp = EASYDIFFICULTYHP;
-                speedModif = EASYSPEEDMODIF;
-                break;
-            case 1:
-                hp = MEDIUMDIFFICULTYHP;
-                speedModif = MEDIUMSPEEDMODIF;
-                break;
-            case 2:
-                hp = HARDDIFFICULTYHP;
-                speedModif = HARDSPEEDMODIF;
-                break;
-            default:
-                break;
-        }
+        std::pair<unsigned int, double> difficultyParameters = getDifficultyParameters(loadedDifficulty);
 
         // Create game from retrieved game settings
         std::pair<GameSettings, GameRecords> loadedSettingsAndRecords = gameSettingsLoader.loadSettingsAndRecords();
-        game.reset(new Game(loadedSettingsAndRecords.first, speedModif, hp, loadedDifficulty));
+        game.reset(new Game(
+            loadedSettingsAndRecords.first,
+            difficultyParameters.second,
+            difficultyParameters.first,
+            loadedDifficulty));
 
         loadedSettings = loadedSettingsAndRecords.first;
         loadedRecords = loadedSettingsAndRecords.second;
+
+        // Changes of settings file are applied to running game
+        settingsWatcher.reset(new SettingsWatcher(settingsPath));
+
+        // Records reached since are logged next to settings file
+        recordsLog.reset(new GameRecordsLog(settingsPath));
+        recordsLog->load(loadedRecords);
     }
     catch (FileLoaderException & e) {
         layoutView.getSecondaryView()->setWarning(true, "Couldn't load settings file!");
@@ -135,7 +162,7 @@ void GameViewController::updateSettingsLoading() {
 
     // Prepare next phase
     phase = mapLoading;
-    createMenuWithFiles(MAPSPATH, MAPSEXTENSION);
+    createMenuWithMaps();
     layoutView.getSecondaryView()->setTitle("CHOOSE MAP FILE");
 }
 
@@ -168,16 +195,24 @@ void GameViewController::updateMapLoading() {
 
     // Prepare next phase
     phase = playing;
-    layoutView.setSecondaryView(GameDetailView(game.get()));
-    layoutView.setPrimaryView(GameView(game.get()));
+    layoutView.emplaceSecondaryView<GameDetailView>(game.get());
+    layoutView.emplacePrimaryView<GameView>(game.get());
     game->restart();
     keypad(stdscr, TRUE);
 }
 
 void GameViewController::updatePlaying() {
-    nodelay(stdscr, TRUE); //< Set to non-blocking input reading
-
-    int c = getch();
+    // Input is waited for until next change of game, so nothing is done between changes,
+    // paused game waits longest, so changed settings and resizes are still handled
+    std::optional<unsigned int> untilUpdate = game->getTimeToNextUpdate();
+    timeout(untilUpdate ? std::min<unsigned int>(*untilUpdate, INPUTIDLETIMEOUT) : INPUTIDLETIMEOUT);
+
+    int c;
+    {
+        Profiler::Scope profile(Profiler::input);
+        c = getch();
+    }
+    timeout(-1);
 
     // Toggle pause if pressed pause button and unpaused
     if (!(game->isPaused()) && (c == 'p' || c == 'P')) {
@@ -201,37 +236,48 @@ void GameViewController::updatePlaying() {
         playerDir = GameControl::getPlayerRotationFromKey(c);
     }
 
+    // Settings changed in file are applied at the beginning of the update
+    if (settingsWatcher) {
+        std::optional<GameSettings> changedSettings = settingsWatcher->takeSettings();
+        if (changedSettings) {
+            game->changeSettings(*changedSettings);
+            loadedSettings = *changedSettings;
+        }
+    }
+
     // Pass input and update game
     game->update(playerDir);
 
     // Check if game ended
     if (game->getLives() == 0 || game->getCoinsRemaining() == 0) {
-        layoutView.setSecondaryView(SettingsView(false));
-        layoutView.getSecondaryView()->setTitle("GAME OVER");
+        layoutView.emplaceSecondaryView<SettingsView>(false).setTitle("GAME OVER");
         // Check if new highscore
         bool highscore = loadedRecords.addScore(mapName, loadedDifficulty, game->getScore());
-        layoutView.setPrimaryView(
-            GameOverView(
-                game->getScore(),
-                loadedRecords.records[std::make_pair(mapName, loadedDifficulty)],
-                highscore
-            )
+        GameRecords::Rank rank = loadedRecords.getRank(mapName, loadedDifficulty, game->getScore());
+        layoutView.emplacePrimaryView<GameOverView>(
+            game->getScore(),
+            loadedRecords.getBestScore(mapName, loadedDifficulty),
+            highscore,
+            rank.rank,
+            rank.runs
         );
 
-        // Try to save settings together with records back into original file
+        // Try to append run to log, settings file is left untouched
         try {
-            GameSettingsRecordsFileSaver saver(settingsPath);
-            saver.writeSettingsAndRecords(std::make_pair(loadedSettings, loadedRecords));
+            recordsLog->append(mapName, loadedDifficulty, game->getScore());
         }
         catch (FileLoaderException & e) {
-            layoutView.getSecondaryView()->setWarning(true, "Couldn't save settings and records");
+            layoutView.getSecondaryView()->setWarning(true, "Couldn't save record");
+        }
+
+        for (auto & trigger : game->getTriggerLateness()) {
+            Profiler::recordLateness(trigger.name, trigger.performed, trigger.skipped);
         }
 
         // Prepare next phase
+        settingsWatcher.reset();
         phase = endGame;
     }
-
-    nodelay(stdscr, FALSE);
 }
 
 void GameViewController::updateEndGame() {
@@ -253,15 +299,32 @@ GameViewController::GameViewController()
     menu->addOption("easy");
     menu->addOption("medium");
     menu->addOption("hard");
-    layoutView.setSecondaryView(OptionMenuView(menu.get()));
-    layoutView.getSecondaryView()->setTitle("CHOOSE DIFFICULTY");
-    layoutView.getSecondaryView()->setWarning(false);
+    menu->addOption("expert");
+    OptionMenuView & menuView = layoutView.emplaceSecondaryView<OptionMenuView>(menu.get());
+    menuView.setTitle("CHOOSE DIFFICULTY");
+    menuView.setWarning(false);
 
-    layoutView.setPrimaryView(LoadingView());
+    layoutView.emplacePrimaryView<LoadingView>();
 }
 
 GameViewController::~GameViewController() { }
 
+std::pair<unsigned int, double> GameViewController::getDifficultyParameters(unsigned int difficulty) {
+    switch (difficulty) {
+        case 0:
+            return std::make_pair(EASYDIFFICULTYHP, EASYSPEEDMODIF);
+        case 1:
+            return std::make_pair(MEDIUMDIFFICULTYHP, MEDIUMSPEEDMODIF);
+        case 2:
+            return std::make_pair(HARDDIFFICULTYHP, HARDSPEEDMODIF);
+        case 3:
+            return std::make_pair(EXPERTDIFFICULTYHP, EXPERTSPEEDMODIF);
+        default:
+            break;
+    }
+    return std::make_pair(0, 0.0);
+}
+
 
 AppState GameViewController::update() {
     // If unable to display pause game
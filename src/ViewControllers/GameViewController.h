@@ -15,6 +15,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "ViewControllers/ViewController.h"
 #include "GameLogic/Game.h"
@@ -22,6 +24,8 @@
 #include "Utilities/Contexts/OptionMenu.h"
 #include "Utilities/Contexts/GameSettings.h"
 #include "Utilities/Contexts/GameRecords.h"
+#include "Utilities/FileManagers/GameRecordsLog.h"
+#include "Utilities/SettingsWatcher.h"
 
 /**
  * @brief Game view controller
@@ -53,7 +57,9 @@ protected:
 
     std::string settingsPath; //< Path to file from which were settings loaded
     GameSettings loadedSettings; //< Game settings context loaded from file
+    std::unique_ptr<SettingsWatcher> settingsWatcher; //< Watcher of changes of settings file
     GameRecords loadedRecords; //< Game records context loaded from file
+    std::unique_ptr<GameRecordsLog> recordsLog; //< Log of records reached with loaded settings
     unsigned int loadedDifficulty; //< Set difficulty of game
     std::string mapName; //< Name of file with map
 
@@ -65,9 +71,17 @@ protected:
      * Store the OptionMenu into menu
      *
      * @param filePath Path to directory
-     * @param extension Extension that files should have
+     * @param extensions Extensions of which files should have one
      */
-    void createMenuWithFiles(const std::string & filePath, const std::string & extension);
+    void createMenuWithFiles(const std::string & filePath, const std::vector<std::string> & extensions);
+
+    /**
+     * @brief Create OptionMenu with options as map files described by MapIndex
+     *
+     * Store the OptionMenu into menu
+     *
+     */
+    void createMenuWithMaps();
 
     /**
      * @brief Update in difficultyChoosing phase
@@ -112,6 +126,17 @@ public:
      */
     ~GameViewController();
 
+    /**
+     * @brief Get game parameters for difficulty
+     *
+     * Difficulties are 0 - easy, 1 - medium, 2 - hard, 3 - expert.
+     *
+     * @param difficulty difficulty of game
+     * @return std::pair<unsigned int, double> initial lives amount and enemy speed
+     *      multiplier in frightened mode, zeros for unknown difficulty
+     */
+    static std::pair<unsigned int, double> getDifficultyParameters(unsigned int difficulty);
+
     AppState update() override;
 
     void draw() override;
@@ -18,14 +18,14 @@ void MainMenuViewController::handleMenuSelect(unsigned int i) {
 }
 
 MainMenuViewController::MainMenuViewController() : ViewController(), layoutView() {
-    layoutView.setPrimaryView(LogoView());
+    layoutView.emplacePrimaryView<LogoView>();
 
     // Prepare menu
     menu.reset(new OptionMenu());
     menu->addOption("play");
     menu->addOption("exit");
 
-    layoutView.setSecondaryView(OptionMenuView(menu.get()));
+    layoutView.emplaceSecondaryView<OptionMenuView>(menu.get());
 }
 
 MainMenuViewController::~MainMenuViewController() { }
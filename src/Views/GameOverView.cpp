@@ -1,9 +1,12 @@
 #include "Views/GameOverView.h"
 
-GameOverView::GameOverView(unsigned long reachedScore, unsigned long previousHighscore, bool isRecord) :
+GameOverView::GameOverView(unsigned long reachedScore, unsigned long previousHighscore, bool isRecord,
+    size_t scoreRank, size_t allRuns) :
     score(reachedScore),
     highscore(previousHighscore),
-    isHighscore(isRecord) {
+    isHighscore(isRecord),
+    rank(scoreRank),
+    runs(allRuns) {
     minSizeY = 10;
     minSizeX = 2;
 }
@@ -17,8 +20,9 @@ void GameOverView::draw(WINDOW * intoWindow) {
         return;
     }
 
-    wclear(intoWindow);
+    werase(intoWindow);
     box(intoWindow, 0, 0);
+    damageWhole();
 
     std::string displayText;
 
@@ -47,10 +51,16 @@ void GameOverView::draw(WINDOW * intoWindow) {
     mvwprintw(intoWindow, 6, centeredXForText(displayText), displayText.c_str());
     wattroff(intoWindow, A_BOLD);
 
+    if (runs > 0) {
+        displayText = "rank " + std::to_string(rank) + " of " + std::to_string(runs);
+
+        mvwprintw(intoWindow, 8, centeredXForText(displayText), displayText.c_str());
+
+        if (displayText.length() + 2 > minSizeX) {
+            minSizeX = displayText.length() + 2;
+        }
+    }
+
     wnoutrefresh(intoWindow);
     needsRefresh = false;
-}
-
-GameOverView * GameOverView::clone() const {
-    return new GameOverView(*this);
 }
\ No newline at end of file
@@ -22,6 +22,8 @@ private:
     unsigned long score; //< Achieved score
     unsigned long highscore; //< Highscore for this configuration
     bool isHighscore; //< Reached highscore
+    size_t rank; //< Rank of score among runs for this configuration
+    size_t runs; //< Runs for this configuration, 0 if rank is not shown
 
 public:
 
@@ -31,8 +33,11 @@ public:
      * @param reachedScore Achieved score
      * @param previousHighscore Highscore for this configuration
      * @param isRecord Did reach highscore
+     * @param scoreRank Rank of score among runs for this configuration
+     * @param allRuns Runs for this configuration, 0 if rank should not be shown
      */
-    GameOverView(unsigned long reachedScore, unsigned long previousHighscore, bool isRecord);
+    GameOverView(unsigned long reachedScore, unsigned long previousHighscore, bool isRecord,
+        size_t scoreRank = 0, size_t allRuns = 0);
 
     /**
      * @brief Destroy the Game Over View object
@@ -41,8 +46,6 @@ public:
     ~GameOverView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    GameOverView * clone() const override;
 };
 
 #endif /* GAMEOVERVIEW_H */
\ No newline at end of file
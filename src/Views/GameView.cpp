@@ -1,25 +1,94 @@
+#include <algorithm>
 #include <typeinfo>
 
 #include "Views/GameView.h"
+#include "Utilities/Profiler.h"
+
+size_t GameView::followInDimension(size_t viewport, size_t viewportSize, size_t boardSize, int pos) {
+    if (viewportSize >= boardSize) {
+        return 0;
+    }
+
+    // Position should stay at least quarter of viewport away from its edges
+    int deadZone = viewportSize / 4;
+    int first = viewport;
+    if (pos < first + deadZone) {
+        first = pos - deadZone;
+    } else if (pos >= first + (int) viewportSize - deadZone) {
+        first = pos - (int) viewportSize + deadZone + 1;
+    }
+
+    return std::clamp(first, 0, (int) (boardSize - viewportSize));
+}
+
+bool GameView::updateViewport() {
+    size_t boardX = gameToDraw->getDimensionX();
+    size_t boardY = gameToDraw->getDimensionY();
+
+    size_t previousX = viewportX;
+    size_t previousY = viewportY;
+    size_t previousSizeX = viewportSizeX;
+    size_t previousSizeY = viewportSizeY;
+
+    // Board that fits is centered (the same way as other views), else it is
+    // drawn inside of box
+    if (boardX + 1 <= sizeX) {
+        viewportSizeX = boardX;
+        offsetX = (sizeX - boardX - 1) / 2;
+    } else {
+        viewportSizeX = (sizeX > 2) ? sizeX - 2 : 0;
+        offsetX = 1;
+    }
+    if (boardY + 1 <= sizeY) {
+        viewportSizeY = boardY;
+        offsetY = (sizeY - boardY - 1) / 2;
+    } else {
+        viewportSizeY = (sizeY > 2) ? sizeY - 2 : 0;
+        offsetY = 1;
+    }
+
+    Position playerPos = gameToDraw->player ? gameToDraw->player->getTransform().position : Position();
+    viewportX = followInDimension(viewportX, viewportSizeX, boardX, playerPos.x);
+    viewportY = followInDimension(viewportY, viewportSizeY, boardY, playerPos.y);
+
+    return previousX != viewportX || previousY != viewportY
+        || previousSizeX != viewportSizeX || previousSizeY != viewportSizeY;
+}
+
+bool GameView::isInViewport(const Position & pos) const {
+    return pos.x >= (int) viewportX && pos.x < (int) (viewportX + viewportSizeX)
+        && pos.y >= (int) viewportY && pos.y < (int) (viewportY + viewportSizeY);
+}
 
 void GameView::drawGameElement(WINDOW * intoWindow, const Position & at, unsigned int colorPair, char c) {
+    if (!isInViewport(at)) {
+        return;
+    }
+
+    unsigned int y = offsetY + (at.y - viewportY);
+    unsigned int x = offsetX + (at.x - viewportX);
     wattron(intoWindow, COLOR_PAIR(colorPair));
-    mvwaddch(intoWindow, centeredYInWindow(at.y), centeredXInWindow(at.x), c);
+    mvwaddch(intoWindow, y, x, c);
     wattroff(intoWindow, COLOR_PAIR(colorPair));
+    damage(y, x);
 }
 
 void GameView::drawBoard(WINDOW * intoWindow) {
-    for (size_t y = 0; y < gameToDraw->getDimensionY(); y++) {
-        for (size_t x = 0; x < gameToDraw->getDimensionX(); x++) {
-            Position pos(x, y);
-            DisplayInformation displayTile = Board::Tile::typeDisplay(gameToDraw->board->tileAt(pos));
-            drawGameElement(intoWindow, pos, displayTile.second, displayTile.first);
+    std::vector<Board::Tile::Type> buffer;
+    for (size_t y = viewportY; y < viewportY + viewportSizeY; y++) {
+        const Board::Tile::Type * row = gameToDraw->board->tileRow(y, viewportX, viewportSizeX, buffer);
+        for (size_t x = viewportX; x < viewportX + viewportSizeX; x++) {
+            DisplayInformation displayTile = Board::Tile::typeDisplay(row[x - viewportX]);
+            drawGameElement(intoWindow, Position(x, y), displayTile.second, displayTile.first);
         }
     }
 }
 
 void GameView::drawDiff(WINDOW * intoWindow) {
     for (auto & pos : gameToDraw->diffRedraw) {
+        if (!isInViewport(pos)) { //< Changes outside of viewport are drawn when viewport moves
+            continue;
+        }
         DisplayInformation displayTile = Board::Tile::typeDisplay(gameToDraw->board->tileAt(pos));
         drawGameElement(intoWindow, pos, displayTile.second, displayTile.first);
     }
@@ -36,22 +105,33 @@ void GameView::drawPlayer(WINDOW * intoWindow) {
 }
 
 void GameView::drawEnemies(WINDOW * intoWindow) {
-    for (auto & e : gameToDraw->ghosts) {
-        if (!e->isAlive()) {
+    const Enemies & ghosts = gameToDraw->ghosts;
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        if (!ghosts.isAlive(i) || !isInViewport(ghosts.getPosition(i))) {
             continue;
         }
-        DisplayInformation displayEnemy = e->displayEntity();
-        drawGameElement(intoWindow, e->getTransform().position, displayEnemy.second, displayEnemy.first);
+        DisplayInformation displayEnemy = ghosts.displayEntity(i);
+        drawGameElement(intoWindow, ghosts.getPosition(i), displayEnemy.second, displayEnemy.first);
     }
 }
 
-GameView::GameView(Game * game) : View(), gameToDraw(game) {
+GameView::GameView(Game * game)
+    :
+    View(),
+    gameToDraw(game),
+    viewportX(0),
+    viewportY(0),
+    viewportSizeX(0),
+    viewportSizeY(0),
+    offsetX(0),
+    offsetY(0) {
     ableToDisplay = false;
 
     if (gameToDraw != nullptr) {
         ableToDisplay = true;
-        minSizeX = gameToDraw->getDimensionX() + 1;
-        minSizeY = gameToDraw->getDimensionY() + 1;
+        // Board that is larger than minimal size is drawn through viewport
+        minSizeX = std::min<size_t>(gameToDraw->getDimensionX(), GAMEVIEWMINSIZEX) + 1;
+        minSizeY = std::min<size_t>(gameToDraw->getDimensionY(), GAMEVIEWMINSIZEY) + 1;
     }
 }
 
@@ -60,16 +140,22 @@ GameView::~GameView() { }
 void GameView::draw(WINDOW * intoWindow) {
     getWindowSize(intoWindow);
 
-    if (!(needsRefresh || (ableToDisplay && ((gameToDraw->doesNeedRefresh()) || gameToDraw->isPaused())))) {
+    if (!(needsRefresh || (ableToDisplay && gameToDraw->doesNeedRefresh()))) {
         return;
     }
 
+    Profiler::Scope profile(Profiler::drawGame);
+
+    bool viewportChanged = isAbleToDisplay() && updateViewport();
+
     if (sizeChanged) {
-        wclear(intoWindow);
+        werase(intoWindow);
         box(intoWindow, 0, 0);
-        if (isAbleToDisplay()) { //< Draw whole board only on resize or beggining
-            drawBoard(intoWindow);
-        }
+        damageWhole();
+    }
+    if (isAbleToDisplay() && (sizeChanged || viewportChanged)) { //< Draw whole viewport only on
+        // resize, beggining or movement of viewport
+        drawBoard(intoWindow);
     }
 
     // Board needs to be drawn before entities
@@ -82,8 +168,4 @@ void GameView::draw(WINDOW * intoWindow) {
 
     wnoutrefresh(intoWindow);
     needsRefresh = false;
-}
-
-GameView * GameView::clone() const {
-    return new GameView(*this);
 }
\ No newline at end of file
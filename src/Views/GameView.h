@@ -11,6 +11,9 @@
 #ifndef GAMEVIEW_H
 #define GAMEVIEW_H
 
+#define GAMEVIEWMINSIZEX 30 //< Minimal width of view for boards that don't fit
+#define GAMEVIEWMINSIZEY 15 //< Minimal height of view for boards that don't fit
+
 #include <tuple>
 
 #include "Views/View.h"
@@ -21,6 +24,11 @@
 /**
  * @brief Game view
  *
+ * Board that fits into window is drawn centered. Board that doesn't fit is
+ * drawn through viewport, which follows the player once the player leaves area
+ * in the middle of viewport (dead zone). Only tiles and entities inside viewport
+ * are drawn, so cost of drawing depends on size of window, not size of board.
+ *
  */
 class GameView : public View {
 protected:
@@ -28,10 +36,47 @@ protected:
 
     typedef std::pair<char, NCColors::ColorPairs> DisplayInformation;
 
+    // Viewport in board coordinates
+    size_t viewportX; //< First visible column of board
+    size_t viewportY; //< First visible row of board
+    size_t viewportSizeX; //< Amount of visible columns
+    size_t viewportSizeY; //< Amount of visible rows
+    int offsetX; //< Column in window of column 0 of board
+    int offsetY; //< Row in window of row 0 of board
+
+    /**
+     * @brief Update viewport to window size and position of player
+     *
+     * @return true viewport has moved or changed its size
+     * @return false
+     */
+    bool updateViewport();
+
+    /**
+     * @brief Move viewport in one dimension so position is outside of dead zone
+     *
+     * @param viewport first visible coordinate
+     * @param viewportSize amount of visible coordinates
+     * @param boardSize size of board in dimension
+     * @param pos coordinate of position to follow
+     * @return size_t new first visible coordinate
+     */
+    static size_t followInDimension(size_t viewport, size_t viewportSize, size_t boardSize, int pos);
+
+    /**
+     * @brief Is position inside of viewport
+     *
+     * @param pos position in board
+     * @return true
+     * @return false
+     */
+    bool isInViewport(const Position & pos) const;
+
     /**
      * @brief Draw char with options into window at position
      *
-     * Position is adjusted to be centered in window.
+     * Position in board is converted into position in window, positions outside
+     * of viewport are not drawn.
      *
      * @param intoWindow Window to draw char into
      * @param at Position of char
@@ -41,7 +86,7 @@ protected:
     void drawGameElement(WINDOW * intoWindow, const Position & at, unsigned int colorPair, char c);
 
     /**
-     * @brief Draw whole game board
+     * @brief Draw part of game board in viewport
      *
      * @param intoWindow Window to draw into
      */
@@ -87,8 +132,6 @@ public:
     virtual ~GameView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    GameView * clone() const override;
 };
 
 #endif /* GAMEVIEW_H */
\ No newline at end of file
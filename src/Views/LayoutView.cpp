@@ -1,47 +1,51 @@
 #include "Views/LayoutView.h"
+#include "Views/Renderers/Renderer.h"
+#include "Utilities/Profiler.h"
+#include "Utilities/Tracer.h"
 #include <iostream>
 
-void LayoutView::recreateWindows() {
-    removeWindows();
+bool LayoutView::hasGeometry(WINDOW * window, int windowSizeY, int windowSizeX, int beginY, int beginX) {
+    if (window == nullptr) {
+        return false;
+    }
+
+    int maxY, maxX, begY, begX;
+    getmaxyx(window, maxY, maxX);
+    getbegyx(window, begY, begX);
+    return maxY == windowSizeY && maxX == windowSizeX && begY == beginY && begX == beginX;
+}
 
+bool LayoutView::recreateWindows() {
     // Create windows with fixed secondary view size and flexible primary view size
-    unsigned int secondaryX = 10;
+    int secondaryX = 10;
     if (secondaryView) {
         secondaryX = secondaryView->getMinSizeX();
     }
+    int primaryX = (int)sizeX - secondaryX - 1;
 
-    primaryWindow = newwin(sizeY, sizeX - secondaryX - 1, 0, 0);
-    secondaryWindow = newwin(sizeY, secondaryX, 0, sizeX - secondaryX);
-}
-
-LayoutView::LayoutView() : View(), primaryWindow(nullptr), secondaryWindow(nullptr) { }
-
-LayoutView::LayoutView(const LayoutView & toCopy) : View(toCopy), primaryWindow(nullptr), secondaryWindow(nullptr) {
-    if (toCopy.primaryView) {
-        primaryView.reset(toCopy.getPrimaryView()->clone());
-    }
-    if (toCopy.secondaryView) {
-        secondaryView.reset(toCopy.getSecondaryView()->clone());
+    if (hasGeometry(primaryWindow, sizeY, primaryX, 0, 0)
+        && hasGeometry(secondaryWindow, sizeY, secondaryX, 0, sizeX - secondaryX)) {
+        return false;
     }
-}
 
-LayoutView & LayoutView::operator = (const LayoutView & toCopy) {
     removeWindows();
-    if (toCopy.getPrimaryView() != nullptr) {
-        primaryView.reset(toCopy.getPrimaryView()->clone());
-    } else {
-        primaryView.release();
-    }
+    primaryWindow = newwin(sizeY, primaryX, 0, 0);
+    secondaryWindow = newwin(sizeY, secondaryX, 0, sizeX - secondaryX);
+    return true;
+}
 
-    if (toCopy.getSecondaryView() != nullptr) {
-        secondaryView.reset(toCopy.getSecondaryView()->clone());
-    } else {
-        secondaryView.release();
-    }
+bool LayoutView::damageScreen(View & view, WINDOW * window) {
+    int beginY, beginX;
+    getbegyx(window, beginY, beginX);
 
-    return *this;
+    std::vector<Region> regions = view.takeDamage();
+    for (auto & region : regions) {
+        Renderer::get().damage(beginY + region.y, beginX + region.x, region.sizeY, region.sizeX);
+    }
+    return !regions.empty();
 }
 
+LayoutView::LayoutView() : View(), primaryWindow(nullptr), secondaryWindow(nullptr), viewsReplaced(false) { }
 
 LayoutView::~LayoutView() {
     removeWindows();
@@ -49,7 +53,8 @@ LayoutView::~LayoutView() {
 
 void LayoutView::draw(WINDOW *) {
     getWindowSize();
-    if (sizeChanged || needsRefresh) {
+    if (sizeChanged || needsRefresh || viewsReplaced) {
+        bool wasAbleToDisplay = ableToDisplay;
         minSizeX = 10;
         minSizeY = 10;
         if (primaryView) {
@@ -68,17 +73,21 @@ void LayoutView::draw(WINDOW *) {
         // Size is smaller than minimum size
         if ((sizeX < minSizeX) || (sizeY < minSizeY)) {
             ableToDisplay = false;
-            clear();
+            Renderer::get().clearScreen();
 
             curs_set(0);
             noecho();
 
             mvprintw(1, 1, "Please resize the window");
-            refresh();
+            wnoutrefresh(stdscr);
+            Renderer::get().updateScreen();
             return;
         } else {
             ableToDisplay = true;
-            setNeedsRefresh();
+            // Replaced view is drawn alone, whole screen only after resize or resize message
+            if (sizeChanged || needsRefresh || !wasAbleToDisplay) {
+                setNeedsRefresh();
+            }
         }
     }
 
@@ -86,22 +95,40 @@ void LayoutView::draw(WINDOW *) {
         return;
     }
 
-    if (needsRefresh) {
-        clear();
+    Tracer::Scope trace("frame", "render");
+
+    bool damaged = needsRefresh;
+    if (needsRefresh || (viewsReplaced && recreateWindows())) {
+        // Windows moved or screen was resized, everything is drawn again
+        setNeedsRefresh();
+        Renderer::get().clearScreen();
         recreateWindows();
-        refresh();
+        wnoutrefresh(stdscr);
+        damaged = true;
     }
+    viewsReplaced = false;
 
     // Draw primary and secondary view
     if (primaryView) {
         primaryView->draw(primaryWindow);
+        damaged = damageScreen(*primaryView, primaryWindow) || damaged;
     }
     
     if (secondaryView) {
         secondaryView->draw(secondaryWindow);
+        damaged = damageScreen(*secondaryView, secondaryWindow) || damaged;
     }
 
-    doupdate(); // Display drawn elements to screen
+    // Nothing changed, terminal is left untouched
+    if (!damaged) {
+        needsRefresh = false;
+        return;
+    }
+
+    {
+        Profiler::Scope profile(Profiler::screenUpdate);
+        Renderer::get().updateScreen(); // Display drawn elements to screen
+    }
     needsRefresh = false;
 }
 
@@ -122,7 +149,7 @@ void LayoutView::removeWindows() {
     }
     if (secondaryWindow != nullptr) {
         delwin(secondaryWindow);
-        primaryWindow = nullptr;
+        secondaryWindow = nullptr;
     }
 }
 
@@ -142,16 +169,12 @@ View * LayoutView::getSecondaryView() const {
     return secondaryView.get();
 }
 
-void LayoutView::setPrimaryView(const View & view) {
-    primaryView.reset(view.clone());
-    setNeedsRefresh();
+void LayoutView::setPrimaryView(std::unique_ptr<View> view) {
+    primaryView = std::move(view);
+    viewsReplaced = true;
 }
 
-void LayoutView::setSecondaryView(const View & view) {
-    secondaryView.reset(view.clone());
-    setNeedsRefresh();
+void LayoutView::setSecondaryView(std::unique_ptr<View> view) {
+    secondaryView = std::move(view);
+    viewsReplaced = true;
 }
-
-LayoutView * LayoutView::clone() const {
-    return new LayoutView(*this);
-}
\ No newline at end of file
@@ -12,6 +12,7 @@
 #define LAYOUTVIEW_H
 
 #include <memory>
+#include <utility>
 
 #include "Views/View.h"
 
@@ -21,6 +22,13 @@
  * Divides screen into left and right portion and creates two window.
  * Primary with size priority and secondary with fixed size.
  *
+ * Screen is updated only if some view damaged its window.
+ *
+ * Layout view owns its views, they are constructed in place by emplace
+ * methods or moved in. Replacing view keeps windows (if their size didn't
+ * change) and only replaced view is redrawn, whole screen is cleared only
+ * after resize.
+ *
  */
 class LayoutView : public View {
 protected:
@@ -32,26 +40,50 @@ protected:
     std::unique_ptr<View> secondaryView; //< Pointer to view that should be drawn
     // in secondaryWindow
 
+    bool viewsReplaced; //< Indicator that view was replaced since last draw
+
     /**
      * @brief Recreate windows with correct sizes
      *
+     * Windows that already have correct size and position are kept.
+     *
+     * @return true windows were recreated
+     * @return false windows were kept
      */
-    void recreateWindows();
+    bool recreateWindows();
 
-public:
+    /**
+     * @brief Does window exist with given size and position
+     *
+     * @param window window
+     * @param windowSizeY number of lines
+     * @param windowSizeX number of columns
+     * @param beginY line of upper left corner
+     * @param beginX column of upper left corner
+     * @return true
+     * @return false
+     */
+    static bool hasGeometry(WINDOW * window, int windowSizeY, int windowSizeX, int beginY, int beginX);
 
     /**
-     * @brief Construct a new Layout View object
+     * @brief Pass regions damaged by view to renderer in screen coordinates
      *
+     * @param view view drawn into window
+     * @param window window of view
+     * @return true view damaged some region
+     * @return false
      */
-    LayoutView();
+    bool damageScreen(View & view, WINDOW * window);
+
+public:
 
     /**
      * @brief Construct a new Layout View object
      *
-     * @param toCopy
      */
-    LayoutView(const LayoutView & toCopy);
+    LayoutView();
+
+    LayoutView(const LayoutView &) = delete;
 
     /**
      * @brief Destroy the Layout View object
@@ -59,7 +91,7 @@ public:
      */
     ~LayoutView();
 
-    LayoutView & operator = (const LayoutView & toCopy);
+    LayoutView & operator = (const LayoutView &) = delete;
 
     void draw(WINDOW * intoWindow = stdscr) override;
 
@@ -102,18 +134,48 @@ public:
     /**
      * @brief Set view as primary view
      *
-     * @param view primary view
+     * @param view primary view, layout view takes ownership
      */
-    void setPrimaryView(const View & view);
+    void setPrimaryView(std::unique_ptr<View> view);
 
     /**
      * @brief Set view as secondary view
      *
-     * @param view secondary view
+     * @param view secondary view, layout view takes ownership
+     */
+    void setSecondaryView(std::unique_ptr<View> view);
+
+    /**
+     * @brief Construct primary view in place
+     *
+     * @tparam T type of view
+     * @tparam Args types of arguments of constructor of view
+     * @param args arguments of constructor of view
+     * @return T& constructed view
      */
-    void setSecondaryView(const View & view);
+    template <typename T, typename ... Args>
+    T & emplacePrimaryView(Args && ... args) {
+        auto view = std::make_unique<T>(std::forward<Args>(args)...);
+        T & constructed = *view;
+        setPrimaryView(std::move(view));
+        return constructed;
+    }
 
-    LayoutView * clone() const override;
+    /**
+     * @brief Construct secondary view in place
+     *
+     * @tparam T type of view
+     * @tparam Args types of arguments of constructor of view
+     * @param args arguments of constructor of view
+     * @return T& constructed view
+     */
+    template <typename T, typename ... Args>
+    T & emplaceSecondaryView(Args && ... args) {
+        auto view = std::make_unique<T>(std::forward<Args>(args)...);
+        T & constructed = *view;
+        setSecondaryView(std::move(view));
+        return constructed;
+    }
 };
 
 #endif /* LAYOUTVIEW_H */
@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "Views/LoadingView.h"
 #include "Utilities/NCColors.h"
 
@@ -87,11 +89,9 @@ void LoadingView::nextFrame() {
     } else if (currentFrame == LOADINGVIEWFRAMES - 1) {
         countingUp = false;
     }
-
-    setNeedsRefresh();
 }
 
-LoadingView::LoadingView() : View(), currentFrame(0), countingUp(true) {
+LoadingView::LoadingView() : View(), currentFrame(0), drawnFrame(0), countingUp(true) {
     minSizeX = LOADINGVIEWFRAMEWIDTH + 2;
     minSizeY = LOADINGVIEWFRAMEHEIGHT + 3;
 }
@@ -100,26 +100,30 @@ void LoadingView::draw(WINDOW * intoWindow) {
     nextFrame();
     getWindowSize(intoWindow);
 
-    if (!needsRefresh) {
+    if (!needsRefresh && currentFrame == drawnFrame) {
         return;
     }
 
-    wclear(intoWindow);
-    box(intoWindow, 0, 0);
+    if (needsRefresh) {
+        werase(intoWindow);
+        box(intoWindow, 0, 0);
+        damageWhole();
+    }
 
-    // Draw line in ascii art from current frame
+    // Draw lines in ascii art from current frame, that differ from drawn frame
     wattron(intoWindow, COLOR_PAIR(NCColors::pacman));
     for (size_t i = 0; i < LOADINGVIEWFRAMEHEIGHT; i++) {
+        if (!needsRefresh && std::strcmp(frames[currentFrame][i], frames[drawnFrame][i]) == 0) {
+            continue;
+        }
         mvwprintw(intoWindow, centeredYInWindow(i + 1), centeredXInWindow(1), frames[currentFrame][i]);
+        damage(centeredYInWindow(i + 1), centeredXInWindow(1), 1, LOADINGVIEWFRAMEWIDTH);
     }
     wattroff(intoWindow, COLOR_PAIR(NCColors::pacman));
 
     wnoutrefresh(intoWindow);
+    drawnFrame = currentFrame;
     needsRefresh = false;
 }
 
-LoadingView::~LoadingView() { }
-
-LoadingView * LoadingView::clone() const {
-    return new LoadingView(*this);
-}
\ No newline at end of file
+LoadingView::~LoadingView() { }
\ No newline at end of file
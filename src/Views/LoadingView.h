@@ -29,12 +29,14 @@ class LoadingView : public View {
     // Frames of ascii art
     static const char frames[LOADINGVIEWFRAMES][LOADINGVIEWFRAMEHEIGHT][LOADINGVIEWFRAMEWIDTH + 1];
     unsigned int currentFrame; //< Current frame of ascii art
+    unsigned int drawnFrame; //< Frame of ascii art in window
     bool countingUp; //< Direction of counting
 
     /**
      * @brief Switch to next frame
      *
-     * Changes frame up or down based on countingUp, or if at bound toggle countingUp
+     * Changes frame up or down based on countingUp, or if at bound toggle countingUp.
+     * Only lines that differ from drawn frame are redrawn at next draw.
      *
      */
     void nextFrame();
@@ -53,8 +55,6 @@ public:
     virtual ~LoadingView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    LoadingView * clone() const override;
 };
 
 #endif /* LOADINGVIEW_H */
\ No newline at end of file
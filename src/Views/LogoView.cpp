@@ -24,8 +24,9 @@ void LogoView::draw(WINDOW * intoWindow) {
         return;
     }
 
-    wclear(intoWindow);
+    werase(intoWindow);
     box(intoWindow, 0, 0);
+    damageWhole();
 
     unsigned int yCoord = 4;
 
@@ -42,8 +43,3 @@ void LogoView::draw(WINDOW * intoWindow) {
     wnoutrefresh(intoWindow);
     needsRefresh = false;
 }
-
-LogoView * LogoView::clone() const {
-    return new LogoView(*this);
-}
-
@@ -38,8 +38,6 @@ public:
     virtual ~LogoView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    LogoView * clone() const override;
 };
 
 #endif /* LOGOVIEW_H */
\ No newline at end of file
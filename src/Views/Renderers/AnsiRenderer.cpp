@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <cerrno>
+
+#include "Views/Renderers/AnsiRenderer.h"
+
+namespace {
+    const chtype visibleAttributes = A_BOLD | A_DIM | A_UNDERLINE | A_BLINK | A_REVERSE | A_STANDOUT | A_COLOR;
+
+    /**
+     * @brief Attributes with their SGR parameter
+     *
+     */
+    const std::pair<chtype, const char *> attributeCodes[] = {
+        { A_BOLD, "1" },
+        { A_DIM, "2" },
+        { A_UNDERLINE, "4" },
+        { A_BLINK, "5" },
+        { A_REVERSE | A_STANDOUT, "7" }
+    };
+
+    /**
+     * @brief Get colors of color pair
+     *
+     * @param pair color pair
+     * @return std::pair<short, short> foreground and background, -1 for default
+     */
+    std::pair<short, short> pairColors(short pair) {
+        short foreground = -1, background = -1;
+        if (pair == 0 || pair_content(pair, &foreground, &background) == ERR) {
+            return { -1, -1 };
+        }
+        return { foreground, background };
+    }
+}
+
+AnsiRenderer::AnsiRenderer(int terminal)
+    :
+    output(terminal),
+    lines(0),
+    columns(0),
+    cleared(true),
+    cursorY(-1),
+    cursorX(0),
+    rendition(0),
+    alternateCharset(false) { }
+
+void AnsiRenderer::appendColor(std::string & codes, short color, bool background) {
+    if (!codes.empty()) {
+        codes += ';';
+    }
+    if (color < 0) {
+        codes += background ? "49" : "39";
+    } else if (color < 8) {
+        codes += std::to_string((background ? 40 : 30) + color);
+    } else if (color < 16) {
+        codes += std::to_string((background ? 100 : 90) + color - 8);
+    } else {
+        codes += (background ? "48;5;" : "38;5;") + std::to_string(color);
+    }
+}
+
+void AnsiRenderer::moveCursor(int y, int x) {
+    if (cursorY == y && cursorX == x) {
+        return;
+    }
+
+    if (cursorY == y && x > cursorX) {
+        // Unchanged cells with the same rendition are shorter to rewrite than to skip
+        const chtype * line = &shown[(size_t) y * columns];
+        bool rewritable = (x - cursorX <= ANSIRENDERERMAXREWRITE);
+        for (int c = cursorX; c < x && rewritable; c++) {
+            rewritable = ((line[c] & visibleAttributes) == rendition)
+                && (((line[c] & A_ALTCHARSET) != 0) == alternateCharset);
+        }
+        if (rewritable) {
+            for (int c = cursorX; c < x; c++) {
+                stream += (char) (line[c] & A_CHARTEXT);
+            }
+        } else {
+            stream += "\x1b[";
+            if (x - cursorX > 1) {
+                stream += std::to_string(x - cursorX);
+            }
+            stream += 'C';
+        }
+    } else if (cursorY == y && x == 0) {
+        stream += '\r';
+    } else if (cursorY >= 0 && y == cursorY + 1 && x == 0) {
+        stream += "\x1b[E";
+    } else {
+        stream += "\x1b[" + std::to_string(y + 1);
+        if (x > 0) {
+            stream += ';' + std::to_string(x + 1);
+        }
+        stream += 'H';
+    }
+
+    cursorY = y;
+    cursorX = x;
+}
+
+void AnsiRenderer::setRendition(chtype cell) {
+    chtype wanted = cell & visibleAttributes;
+    if (wanted != rendition) {
+        std::string codes;
+
+        // Attribute can be turned off only by resetting all of them
+        bool removed = false;
+        for (auto & attribute : attributeCodes) {
+            removed = removed || ((rendition & attribute.first) && !(wanted & attribute.first));
+        }
+        if (removed) {
+            codes = "0";
+            rendition = 0;
+        }
+
+        for (auto & attribute : attributeCodes) {
+            if ((wanted & attribute.first) && !(rendition & attribute.first)) {
+                codes += (codes.empty() ? "" : ";") + std::string(attribute.second);
+            }
+        }
+
+        std::pair<short, short> from = pairColors(PAIR_NUMBER(rendition));
+        std::pair<short, short> to = pairColors(PAIR_NUMBER(wanted));
+        if (from.first != to.first) {
+            appendColor(codes, to.first, false);
+        }
+        if (from.second != to.second) {
+            appendColor(codes, to.second, true);
+        }
+
+        if (!codes.empty()) {
+            stream += "\x1b[" + codes + 'm';
+        }
+        rendition = wanted;
+    }
+
+    bool wantedCharset = (cell & A_ALTCHARSET) != 0;
+    if (wantedCharset != alternateCharset) {
+        stream += wantedCharset ? "\x1b(0" : "\x1b(B";
+        alternateCharset = wantedCharset;
+    }
+}
+
+void AnsiRenderer::writeStream() {
+    size_t written = 0;
+    while (written < stream.size()) {
+        ssize_t result = write(output, stream.data() + written, stream.size() - written);
+        if (result < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            return;
+        }
+        written += result;
+    }
+}
+
+void AnsiRenderer::clearScreen() {
+    erase();
+    cleared = true;
+}
+
+void AnsiRenderer::damage(int y, int x, int sizeY, int sizeX) {
+    for (int l = std::max(y, 0); l < y + sizeY && l < (int) damagedColumns.size(); l++) {
+        std::pair<int, int> & columnsOfLine = damagedColumns[l];
+        if (columnsOfLine.first >= columnsOfLine.second) {
+            columnsOfLine = { x, x + sizeX };
+        } else {
+            columnsOfLine = { std::min(columnsOfLine.first, x), std::max(columnsOfLine.second, x + sizeX) };
+        }
+    }
+}
+
+void AnsiRenderer::updateScreen() {
+    int screenLines = getmaxy(newscr);
+    int screenColumns = getmaxx(newscr);
+    if (screenLines != lines || screenColumns != columns) {
+        lines = screenLines;
+        columns = screenColumns;
+        damagedColumns.assign(lines, { 0, 0 });
+        cleared = true;
+    }
+
+    // Terminal is left with default rendition after each update, cursor is placed by first change
+    stream.clear();
+    cursorY = -1;
+    cursorX = 0;
+    rendition = 0;
+    alternateCharset = false;
+
+    if (cleared) {
+        shown.assign((size_t) lines * columns, ' ');
+        stream += "\x1b[0m\x1b(B\x1b[H\x1b[2J";
+        cursorY = 0;
+        damage(0, 0, lines, columns);
+        cleared = false;
+    }
+
+    std::vector<chtype> line(columns + 1);
+    for (int y = 0; y < lines; y++) {
+        int first = std::max(damagedColumns[y].first, 0);
+        int end = std::min(damagedColumns[y].second, columns);
+        damagedColumns[y] = { 0, 0 };
+        if (first >= end) {
+            continue;
+        }
+
+        mvwinchnstr(newscr, y, 0, line.data(), end);
+        chtype * shownLine = &shown[(size_t) y * columns];
+
+        for (int x = first; x < end; x++) {
+            if (line[x] == shownLine[x]) {
+                continue;
+            }
+            moveCursor(y, x);
+            setRendition(line[x]);
+            stream += (char) (line[x] & A_CHARTEXT);
+            shownLine[x] = line[x];
+
+            if (++cursorX >= columns) { //< Cursor at last column waits for next character
+                cursorY = -1;
+            }
+        }
+    }
+
+    if (rendition != 0) {
+        stream += "\x1b[0m";
+    }
+    if (alternateCharset) {
+        stream += "\x1b(B";
+    }
+
+    if (!stream.empty()) {
+        writeStream();
+    }
+}
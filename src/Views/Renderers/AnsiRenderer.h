@@ -0,0 +1,96 @@
+/****************************************************************
+ * @file AnsiRenderer.h
+ * @author Michal Dobes
+ * @brief ANSI renderer
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef ANSIRENDERER_H
+#define ANSIRENDERER_H
+
+#define ANSIRENDERERMAXREWRITE 3 //< Most unchanged cells rewritten instead of moving cursor over them
+
+#include <ncurses.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "Views/Renderers/Renderer.h"
+
+/**
+ * @brief ANSI renderer
+ *
+ * Bypasses output of ncurses: keeps its own buffer of cells shown on terminal,
+ * compares it with virtual screen of ncurses in damaged regions and writes
+ * changed cells as one stream of ANSI escape sequences by single write per update.
+ *
+ * Cursor is moved by the shortest of rewriting few unchanged cells, relative
+ * movement and absolute position. Attributes and colors are set only when
+ * they differ from the previous written cell, by one combined sequence.
+ *
+ */
+class AnsiRenderer : public Renderer {
+protected:
+    int output; //< File descriptor of terminal
+
+    std::vector<chtype> shown; //< Cells shown on terminal, line by line
+    int lines; //< Lines of shown cells
+    int columns; //< Columns of shown cells
+    bool cleared; //< Terminal should be cleared at next update
+    std::vector<std::pair<int, int>> damagedColumns; //< First and after last damaged column of each line
+
+    std::string stream; //< Output of current update
+    int cursorY; //< Line of cursor, -1 if unknown
+    int cursorX; //< Column of cursor
+    chtype rendition; //< Attributes and color pair set on terminal
+    bool alternateCharset; //< Line drawing characters are selected on terminal
+
+    /**
+     * @brief Move cursor before cell
+     *
+     * @param y line of cell
+     * @param x column of cell
+     */
+    void moveCursor(int y, int x);
+
+    /**
+     * @brief Set attributes and colors of cell
+     *
+     * @param cell cell
+     */
+    void setRendition(chtype cell);
+
+    /**
+     * @brief Append SGR parameter of color
+     *
+     * @param codes parameters to append to
+     * @param color color, -1 for default
+     * @param background color is background color
+     */
+    static void appendColor(std::string & codes, short color, bool background);
+
+    /**
+     * @brief Write stream into terminal
+     *
+     */
+    void writeStream();
+
+public:
+    /**
+     * @brief Construct a new ANSI Renderer object
+     *
+     * @param terminal file descriptor of terminal
+     */
+    AnsiRenderer(int terminal = STDOUT_FILENO);
+
+    void clearScreen() override;
+
+    void damage(int y, int x, int sizeY, int sizeX) override;
+
+    void updateScreen() override;
+};
+
+#endif /* ANSIRENDERER_H */
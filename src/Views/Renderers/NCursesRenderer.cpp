@@ -0,0 +1,11 @@
+#include <ncurses.h>
+
+#include "Views/Renderers/NCursesRenderer.h"
+
+void NCursesRenderer::clearScreen() {
+    clear();
+}
+
+void NCursesRenderer::updateScreen() {
+    doupdate();
+}
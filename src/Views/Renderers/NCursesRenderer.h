@@ -0,0 +1,29 @@
+/****************************************************************
+ * @file NCursesRenderer.h
+ * @author Michal Dobes
+ * @brief Ncurses renderer
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef NCURSESRENDERER_H
+#define NCURSESRENDERER_H
+
+#include "Views/Renderers/Renderer.h"
+
+/**
+ * @brief Ncurses renderer
+ *
+ * Updates terminal by doupdate of ncurses.
+ *
+ */
+class NCursesRenderer : public Renderer {
+public:
+    void clearScreen() override;
+
+    void updateScreen() override;
+};
+
+#endif /* NCURSESRENDERER_H */
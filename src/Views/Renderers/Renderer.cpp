@@ -0,0 +1,45 @@
+#include <cstdlib>
+
+#include "Views/Renderers/Renderer.h"
+#include "Views/Renderers/NCursesRenderer.h"
+#include "Views/Renderers/AnsiRenderer.h"
+
+std::unique_ptr<Renderer> Renderer::current;
+
+Renderer::~Renderer() { }
+
+void Renderer::damage(int, int, int, int) { }
+
+std::unique_ptr<Renderer> Renderer::create(const std::string & name) {
+    if (name == "ncurses") {
+        return std::make_unique<NCursesRenderer>();
+    }
+    if (name == "ansi") {
+        return std::make_unique<AnsiRenderer>();
+    }
+    return nullptr;
+}
+
+bool Renderer::use(const std::string & name) {
+    std::unique_ptr<Renderer> renderer = create(name);
+    if (!renderer) {
+        return false;
+    }
+    current = std::move(renderer);
+    return true;
+}
+
+bool Renderer::useFromEnvironment() {
+    const char * name = std::getenv(RENDERERENVIRONMENTVARIABLE);
+    if (name == nullptr || *name == '\0') {
+        return true;
+    }
+    return use(name);
+}
+
+Renderer & Renderer::get() {
+    if (!current) {
+        current = std::make_unique<NCursesRenderer>();
+    }
+    return *current;
+}
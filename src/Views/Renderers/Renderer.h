@@ -0,0 +1,97 @@
+/****************************************************************
+ * @file Renderer.h
+ * @author Michal Dobes
+ * @brief Renderer
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#define RENDERERENVIRONMENTVARIABLE "DOBESMIC_RENDERER" //< Name of renderer used by game
+
+#include <memory>
+#include <string>
+
+/**
+ * @brief Renderer
+ *
+ * Puts composed screen on the terminal. Views draw into ncurses windows and
+ * wnoutrefresh them into the virtual screen (newscr), renderer then updates
+ * the terminal to match the virtual screen in regions damaged since last update.
+ *
+ * Renderer used by game is selected at startup, ncurses is the default.
+ *
+ */
+class Renderer {
+private:
+    static std::unique_ptr<Renderer> current; //< Renderer used by game
+
+public:
+    /**
+     * @brief Destroy the Renderer object
+     *
+     */
+    virtual ~Renderer();
+
+    /**
+     * @brief Erase standard screen and clear terminal at next update
+     *
+     */
+    virtual void clearScreen() = 0;
+
+    /**
+     * @brief Record region of screen changed since last update
+     *
+     * Renderers that compare whole screen ignore it.
+     *
+     * @param y first line
+     * @param x first column
+     * @param sizeY number of lines
+     * @param sizeX number of columns
+     */
+    virtual void damage(int y, int x, int sizeY, int sizeX);
+
+    /**
+     * @brief Update terminal to match virtual screen
+     *
+     */
+    virtual void updateScreen() = 0;
+
+    /**
+     * @brief Create renderer by name
+     *
+     * @param name "ncurses" or "ansi"
+     * @return std::unique_ptr<Renderer> nullptr if name is unknown
+     */
+    static std::unique_ptr<Renderer> create(const std::string & name);
+
+    /**
+     * @brief Select renderer used by game
+     *
+     * @param name "ncurses" or "ansi"
+     * @return true renderer was selected
+     * @return false name is unknown
+     */
+    static bool use(const std::string & name);
+
+    /**
+     * @brief Select renderer named by environment variable RENDERERENVIRONMENTVARIABLE, if set
+     *
+     * @return true renderer was selected or variable is not set
+     * @return false name is unknown
+     */
+    static bool useFromEnvironment();
+
+    /**
+     * @brief Get renderer used by game, ncurses renderer if none was selected
+     *
+     * @return Renderer&
+     */
+    static Renderer & get();
+};
+
+#endif /* RENDERER_H */
@@ -1,3 +1,5 @@
+#include <cstdio>
+
 #include "Views/SecondaryViews/GameDetailView.h"
 #include "Utilities/NCColors.h"
 
@@ -9,6 +11,21 @@ void GameDetailView::drawHint(WINDOW * intoWindow) {
     wattroff(intoWindow, COLOR_PAIR(NCColors::ColorPairs::hint));
 }
 
+void GameDetailView::drawState(WINDOW * intoWindow, size_t index, const std::string & text, attr_t attributes) {
+    if (!needsRefresh && drawnState[index] == text) {
+        return;
+    }
+
+    // Previous text is overwritten by spaces up to border
+    unsigned int y = 3 + index;
+    unsigned int width = (sizeX > 2) ? sizeX - 2 : 0;
+    wattron(intoWindow, attributes);
+    mvwprintw(intoWindow, y, 1, "%-*.*s", width, width, text.c_str());
+    wattroff(intoWindow, attributes);
+    damage(y, 1, 1, width);
+    drawnState[index] = text;
+}
+
 GameDetailView::GameDetailView(Game * game) : SecondaryView(), gameToDraw(game) {
     titleText = "PACMAN";
 
@@ -25,37 +42,41 @@ void GameDetailView::draw(WINDOW * intoWindow) {
         return;
     }
 
-    wclear(intoWindow);
-    box(intoWindow, 0, 0);
+    // Whole view is drawn only when needed, otherwise only changed state lines
+    if (needsRefresh) {
+        werase(intoWindow);
+        box(intoWindow, 0, 0);
+        damageWhole();
 
-    wattron(intoWindow, A_BOLD);
-    mvwprintw(intoWindow, 1, centeredXForText(titleText), titleText.c_str());
-    wattroff(intoWindow, A_BOLD);
+        wattron(intoWindow, A_BOLD);
+        mvwprintw(intoWindow, 1, centeredXForText(titleText), titleText.c_str());
+        wattroff(intoWindow, A_BOLD);
 
+        drawHint(intoWindow);
 
-    if (isAbleToDisplay()) {
-        std::string displayString = "score: ";
-        displayString += std::to_string(gameToDraw->getScore());
-        mvwprintw(intoWindow, 3, 1, displayString.c_str());
-
-        displayString = "lives: ";
-        displayString += std::to_string(gameToDraw->getLives());
-        displayString += "x <3";
-        mvwprintw(intoWindow, 4, 1, displayString.c_str());
+        if (warningDisplayed) {
+            wattron(intoWindow, A_DIM);
+            mvwprintw(intoWindow, sizeY - 2, 1, warningText.c_str());
+            wattroff(intoWindow, A_DIM);
+        }
     }
 
-    drawHint(intoWindow);
+    if (isAbleToDisplay()) {
+        drawState(intoWindow, 0, "score: " + std::to_string(gameToDraw->getScore()));
+        drawState(intoWindow, 1, "lives: " + std::to_string(gameToDraw->getLives()) + "x <3");
 
-    if (warningDisplayed) {
-        wattron(intoWindow, A_DIM);
-        mvwprintw(intoWindow, sizeY - 2, 1, warningText.c_str());
-        wattroff(intoWindow, A_DIM);
+        // Display duration of ghost planning, if ghosts plan
+        std::string planningString;
+        std::optional<double> planningTime = gameToDraw->getPlanningTime();
+        if (planningTime) {
+            char planning[64];
+            snprintf(planning, sizeof(planning), "ai: %.1f ms (max %.1f ms)",
+                *planningTime, *(gameToDraw->getMaxPlanningTime()));
+            planningString = planning;
+        }
+        drawState(intoWindow, 2, planningString, A_DIM);
     }
 
     wnoutrefresh(intoWindow);
     needsRefresh = false;
-}
-
-GameDetailView * GameDetailView::clone() const {
-    return new GameDetailView(*this);
 }
\ No newline at end of file
@@ -11,6 +11,11 @@
 #ifndef GAMEDETAILVIEW_H
 #define GAMEDETAILVIEW_H
 
+#define GAMEDETAILVIEWSTATELINES 3 //< Lines with state of game (score, lives, planning)
+
+#include <array>
+#include <string>
+
 #include "Views/SecondaryViews/SecondaryView.h"
 #include "GameLogic/Game.h"
 
@@ -22,8 +27,20 @@ class GameDetailView : public SecondaryView {
 protected:
     Game * gameToDraw; //< Pointer to Game to draw
 
+    std::array<std::string, GAMEDETAILVIEWSTATELINES> drawnState; //< Texts of state lines in window
+
     void drawHint(WINDOW * intoWindow) override;
 
+    /**
+     * @brief Draw line with state of game, if its text differs from drawn text
+     *
+     * @param intoWindow window to draw into
+     * @param index index of state line
+     * @param text text of line
+     * @param attributes attributes of text
+     */
+    void drawState(WINDOW * intoWindow, size_t index, const std::string & text, attr_t attributes = A_NORMAL);
+
 public:
     /**
      * @brief Construct a new Game Detail View object
@@ -42,8 +59,6 @@ public:
     virtual ~GameDetailView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    GameDetailView * clone() const override;
 };
 
 #endif /* GAMEDETAILVIEW_H */
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Views/SecondaryViews/OptionMenuView.h"
 #include "Utilities/NCColors.h"
 
@@ -12,10 +14,6 @@ void OptionMenuView::drawHint(WINDOW * intoWindow) {
 OptionMenuView::OptionMenuView(OptionMenu * menu) : SecondaryView(), menuToDraw(menu) {
     if (menuToDraw == nullptr) {
         ableToDisplay = false;
-    } else {
-        if (menuToDraw->size() >= 15) {
-            minSizeY = 11 + menuToDraw->size();
-        }
     }
 }
 OptionMenuView::~OptionMenuView() { }
@@ -27,30 +25,37 @@ void OptionMenuView::draw(WINDOW * intoWindow) {
         return;
     }
 
-
-    // Update minimal size by option menu size
-    if (menuToDraw->options.size() >= 15) {
-        minSizeY = 11 + menuToDraw->size();
-    }
-
-    wclear(intoWindow);
+    werase(intoWindow);
     box(intoWindow, 0, 0);
+    damageWhole();
 
     wattron(intoWindow, A_BOLD);
     mvwprintw(intoWindow, 1, centeredXForText(titleText), titleText.c_str());
     wattroff(intoWindow, A_BOLD);
 
     if (isAbleToDisplay()) {
+        // Options are drawn between title and detail, if they don't fit, list
+        // scrolls to keep current selection in the middle
+        size_t visible = sizeY - OPTIONMENUVIEWRESERVEDROWS;
+        size_t current = menuToDraw->getCurrentOption();
+        size_t first = 0;
+        if (menuToDraw->size() > visible && current > visible / 2) {
+            first = std::min(current - (visible / 2), menuToDraw->size() - visible);
+        }
 
-        for (size_t i = 0; i < menuToDraw->options.size(); i++) {
-            if (i == menuToDraw->getCurrentOption()) {
+        for (size_t i = first; i < menuToDraw->options.size() && i < first + visible; i++) {
+            if (i == current) {
                 wattron(intoWindow, COLOR_PAIR(NCColors::ColorPairs::interactive));
             }
-            mvwprintw(intoWindow, 3 + i, 1, menuToDraw->options[i].c_str());
-            if (i == menuToDraw->getCurrentOption()) {
+            mvwaddnstr(intoWindow, 3 + (i - first), 1, menuToDraw->options[i].c_str(), sizeX - 2);
+            if (i == current) {
                 wattroff(intoWindow, COLOR_PAIR(NCColors::ColorPairs::interactive));
             }
         }
+
+        if (current < menuToDraw->size()) {
+            mvwaddnstr(intoWindow, sizeY - 8, 1, menuToDraw->getCurrentOptionDetail().c_str(), sizeX - 2);
+        }
     }
 
     if (warningDisplayed) {
@@ -63,8 +68,4 @@ void OptionMenuView::draw(WINDOW * intoWindow) {
 
     wnoutrefresh(intoWindow);
     needsRefresh = false;
-}
-
-OptionMenuView * OptionMenuView::clone() const {
-    return new OptionMenuView(*this);
 }
\ No newline at end of file
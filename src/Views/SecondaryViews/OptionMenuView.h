@@ -17,9 +17,14 @@
 #include "Views/SecondaryViews/SecondaryView.h"
 #include "Utilities/Contexts/OptionMenu.h"
 
+#define OPTIONMENUVIEWRESERVEDROWS 12 //< Rows of window not used for options (title, detail, hints)
+
 /**
  * @brief Option menu view
  *
+ * Options that don't fit into window are scrolled, detail of current
+ * selection is shown below them.
+ *
  */
 class OptionMenuView : public SecondaryView {
 protected:
@@ -45,8 +50,6 @@ public:
     virtual ~OptionMenuView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    OptionMenuView * clone() const override;
 };
 
 #endif /* MENUVIEW_H */
\ No newline at end of file
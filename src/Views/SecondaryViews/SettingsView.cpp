@@ -21,8 +21,9 @@ void SettingsView::draw(WINDOW * intoWindow) {
         return;
     }
 
-    wclear(intoWindow);
+    werase(intoWindow);
     box(intoWindow, 0, 0);
+    damageWhole();
 
     wattron(intoWindow, A_BOLD);
     mvwprintw(intoWindow, 1, centeredXForText(titleText), titleText.c_str());
@@ -48,7 +49,3 @@ void SettingsView::draw(WINDOW * intoWindow) {
     wnoutrefresh(intoWindow);
     needsRefresh = false;
 }
-
-SettingsView * SettingsView::clone() const {
-    return new SettingsView(*this);
-}
@@ -41,8 +41,6 @@ public:
     virtual ~SettingsView();
 
     void draw(WINDOW * intoWindow = stdscr) override;
-
-    SettingsView * clone() const override;
 };
 
 #endif /* SETTINGSVIEW_H */
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Views/View.h"
 
 void View::getWindowSize(WINDOW * forWindow) {
@@ -28,6 +30,42 @@ unsigned int View::centeredXForText(const std::string & text) const {
     return xPos;
 }
 
+void View::damage(unsigned int y, unsigned int x, unsigned int regionSizeY, unsigned int regionSizeX) {
+    if (regionSizeY == 0 || regionSizeX == 0) {
+        return;
+    }
+
+    if (damagedRegions.size() < VIEWMAXDAMAGEDREGIONS) {
+        damagedRegions.push_back(Region { y, x, regionSizeY, regionSizeX });
+        return;
+    }
+
+    // Too many regions, all are merged into one covering them
+    Region & bounds = damagedRegions.front();
+    for (size_t i = 1; i < damagedRegions.size(); i++) {
+        Region & region = damagedRegions[i];
+        unsigned int endY = std::max(bounds.y + bounds.sizeY, region.y + region.sizeY);
+        unsigned int endX = std::max(bounds.x + bounds.sizeX, region.x + region.sizeX);
+        bounds.y = std::min(bounds.y, region.y);
+        bounds.x = std::min(bounds.x, region.x);
+        bounds.sizeY = endY - bounds.y;
+        bounds.sizeX = endX - bounds.x;
+    }
+    damagedRegions.resize(1);
+
+    unsigned int endY = std::max(bounds.y + bounds.sizeY, y + regionSizeY);
+    unsigned int endX = std::max(bounds.x + bounds.sizeX, x + regionSizeX);
+    bounds.y = std::min(bounds.y, y);
+    bounds.x = std::min(bounds.x, x);
+    bounds.sizeY = endY - bounds.y;
+    bounds.sizeX = endX - bounds.x;
+}
+
+void View::damageWhole() {
+    damagedRegions.clear();
+    damage(0, 0, sizeY, sizeX);
+}
+
 View::View() :
     needsRefresh(true),
     ableToDisplay(true),
@@ -49,6 +87,16 @@ bool View::isAbleToDisplay() {
     return ableToDisplay;
 }
 
+bool View::isDamaged() const {
+    return !damagedRegions.empty();
+}
+
+std::vector<View::Region> View::takeDamage() {
+    std::vector<Region> taken;
+    taken.swap(damagedRegions);
+    return taken;
+}
+
 void View::setWarning(bool to, std::string text) {
     if (warningDisplayed != to || warningText != text) {
         warningDisplayed = to;
@@ -11,9 +11,12 @@
 #ifndef VIEW_H
 #define VIEW_H
 
+#define VIEWMAXDAMAGEDREGIONS 32 //< Damaged regions kept separately, more are merged into one
+
 #include <ncurses.h>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 /**
  * @brief View
@@ -21,8 +24,25 @@
  * Used for displaying information to the screen.
  * Data shoud be held separately from Views.
  *
+ * Each draw records regions of window it has changed (damaged), so only those
+ * are put on the screen and nothing is put on the screen if nothing changed.
+ * Windows are erased by werase, as wclear would make next update clear and
+ * rewrite whole terminal.
+ *
  */
 class View {
+public:
+    /**
+     * @brief Rectangular region of window
+     *
+     */
+    struct Region {
+        unsigned int y; //< First line
+        unsigned int x; //< First column
+        unsigned int sizeY; //< Number of lines
+        unsigned int sizeX; //< Number of columns
+    };
+
 protected:
     bool needsRefresh; //< Indicator that whole view needs to be redrawn
 
@@ -39,6 +59,8 @@ protected:
 
     std::string titleText; //< Text of title
 
+    std::vector<Region> damagedRegions; //< Regions changed by draws since takeDamage
+
     /**
      * @brief Get size of window and update variables assocatied with it
      *
@@ -70,6 +92,22 @@ protected:
      */
     unsigned int centeredXForText(const std::string & text) const;
 
+    /**
+     * @brief Record region of window as changed
+     *
+     * @param y first line
+     * @param x first column
+     * @param regionSizeY number of lines
+     * @param regionSizeX number of columns
+     */
+    void damage(unsigned int y, unsigned int x, unsigned int regionSizeY = 1, unsigned int regionSizeX = 1);
+
+    /**
+     * @brief Record whole window as changed
+     *
+     */
+    void damageWhole();
+
 public:
     /**
      * @brief Construct a new View object
@@ -98,18 +136,26 @@ public:
     bool isAbleToDisplay();
 
     /**
-     * @brief Draw into window
+     * @brief Has view changed its window since last takeDamage
      *
-     * @param intoWindow window to draw into
+     * @return true
+     * @return false
      */
-    virtual void draw(WINDOW * intoWindow = stdscr) = 0;
+    bool isDamaged() const;
 
     /**
-     * @brief Allocate copy of this
+     * @brief Get regions of window changed since last call
      *
-     * @return View* pointer to copy of this
+     * @return std::vector<Region>
      */
-    virtual View * clone() const = 0;
+    std::vector<Region> takeDamage();
+
+    /**
+     * @brief Draw into window
+     *
+     * @param intoWindow window to draw into
+     */
+    virtual void draw(WINDOW * intoWindow = stdscr) = 0;
 
     /**
      * @brief Toggle warning and set warning text
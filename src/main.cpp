@@ -10,12 +10,45 @@
 
 #include <ncurses.h>
 #include <iostream>
+#include <string>
 
 #include "Utilities/NCColors.h"
 #include "StateManager.h"
+#include "HeadlessRunner.h"
+#include "Utilities/Profiler.h"
+#include "Utilities/Tracer.h"
+#include "Views/Renderers/Renderer.h"
 
 
-int main(void) {
+/**
+ * @brief Run game or headless mode selected by arguments
+ *
+ * @param argc number of arguments
+ * @param argv arguments, the first one is program name
+ * @return int exit code
+ */
+int runProgram(int argc, char * argv[]) {
+    // Headless mode: dobesmic --headless <settings file> <map file> [games] [difficulty] [seed]
+    if (argc >= 2 && std::string(argv[1]) == "--headless") {
+        if (argc < 4) {
+            std::cerr << "Usage: " << argv[0] << " --headless <settings file> <map file> [games] [difficulty] [seed]" << std::endl;
+            return 1;
+        }
+
+        try {
+            unsigned long games = (argc >= 5) ? std::stoul(argv[4]) : 1;
+            unsigned int difficulty = (argc >= 6) ? std::stoul(argv[5]) : 1;
+            unsigned int seed = (argc >= 7) ? std::stoul(argv[6]) : GHOSTPLANNERDEFAULTSEED;
+
+            HeadlessRunner runner(argv[2], argv[3], games, difficulty, seed);
+            return runner.run(std::cout);
+        }
+        catch (std::logic_error & e) { //< Number couldn't be converted
+            std::cerr << "Games, difficulty and seed need to be numbers" << std::endl;
+            return 1;
+        }
+    }
+
     initscr(); //< Initialize ncurses
     curs_set(0); //< Hide cursor
     noecho(); //< Don't show input
@@ -26,4 +59,42 @@ int main(void) {
 
     endwin(); //< Close ncurses
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char * argv[]) {
+    // Profiling, tracing and renderer:
+    // dobesmic [--profile <summary file>] [--trace <trace file>] [--renderer <ncurses|ansi>] ...,
+    // or with environment variables
+    Profiler::enableFromEnvironment();
+    Tracer::enableFromEnvironment();
+    if (!Renderer::useFromEnvironment()) {
+        std::cerr << "Unknown renderer, available are ncurses and ansi" << std::endl;
+        return 1;
+    }
+    while (argc >= 3 && (std::string(argv[1]) == "--profile" || std::string(argv[1]) == "--trace"
+        || std::string(argv[1]) == "--renderer")) {
+        if (std::string(argv[1]) == "--profile") {
+            Profiler::enable(argv[2]);
+        } else if (std::string(argv[1]) == "--renderer") {
+            if (!Renderer::use(argv[2])) {
+                std::cerr << "Unknown renderer, available are ncurses and ansi" << std::endl;
+                return 1;
+            }
+        } else if (!Tracer::enable(argv[2])) {
+            std::cerr << "Couldn't open trace file" << std::endl;
+        }
+        argv[2] = argv[0];
+        argc -= 2;
+        argv += 2;
+    }
+
+    int result = runProgram(argc, argv);
+
+    if (!Profiler::finish()) {
+        std::cerr << "Couldn't write profiler summary" << std::endl;
+    }
+    if (!Tracer::finish()) {
+        std::cerr << "Couldn't write trace" << std::endl;
+    }
+    return result;
+}
@@ -1,7 +1,59 @@
+#include <algorithm>
 #include <assert.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include "BenchmarkComparison.h"
+#include "BenchmarkRunner.h"
 
 #include "Structures/Transforms/Transform.h"
 #include "Structures/Matrix.h"
+#include "Structures/ChunkedMatrix.h"
+#include "Structures/Histogram.h"
+#include "GameLogic/Game.h"
+#include "GameLogic/GameObservation.h"
+#include "GameLogic/MapAnalysis.h"
+#include "GameLogic/MazeGenerator.h"
+#include "GameLogic/AI/FlowFields.h"
+#include "GameLogic/AI/GhostPlanner.h"
+#include "Utilities/Contexts/Autopilot.h"
+#include "Utilities/Contexts/MapIndex.h"
+#include "Utilities/FileManagers/GameRecordsLog.h"
+#include "Utilities/FileManagers/GameSettingsRecordsFileLoader.h"
+#include "Utilities/FileManagers/BoardFileLoader.h"
+#include "Utilities/FileManagers/BoardFileSaver.h"
+#include "Utilities/SettingsWatcher.h"
+#include "Utilities/TerminalScreen.h"
+#include "Utilities/Timer.h"
+#include "Utilities/Tracer.h"
+#include "Views/View.h"
+#include "Views/LayoutView.h"
+#include "Views/Renderers/AnsiRenderer.h"
+
+/**
+ * @brief Create tiles of board with one row open and walls elsewhere
+ *
+ * Open row goes through whole board, so it teleports at both edges.
+ *
+ * @param sizeX size in x dimension
+ * @param sizeY size in y dimension
+ * @param row index of open row
+ * @param type type of tiles in open row
+ * @return Matrix<Board::Tile::Type>
+ */
+Matrix<Board::Tile::Type> corridorBoard(size_t sizeX, size_t sizeY, size_t row,
+    Board::Tile::Type type = Board::Tile::Type::space) {
+    Matrix<Board::Tile::Type> tiles(sizeX, sizeY);
+    for (size_t y = 0; y < sizeY; y++) {
+        for (size_t x = 0; x < sizeX; x++) {
+            tiles.at(x, y) = (y == row) ? type : Board::Tile::Type::wall;
+        }
+    }
+    return tiles;
+}
 
 void matrixTests() {
     Matrix<int> m1(10, 10);
@@ -49,7 +101,917 @@ void transformTests() {
 
 }
 
+void observationTests() {
+    // Board wider than one SIMD block and one word, with every type of tile
+    Matrix<Board::Tile::Type> tiles(83, 5);
+    for (size_t y = 0; y < tiles.getSizeY(); y++) {
+        for (size_t x = 0; x < tiles.getSizeX(); x++) {
+            tiles.at(x, y) = static_cast<Board::Tile::Type>((x * 7 + y) % 5);
+        }
+    }
+    tiles.at(2, 2) = Board::Tile::Type::coin;
+    Board board(tiles, Position(1, 1), Position(2, 2));
+
+    Game game(GameSettings(350, 400, 7000, 20000, 15000, 8000, 20000, 5000), 1.5, 3);
+    game.loadBoard(board);
+    game.restart();
+
+    GameObservation observation(&game);
+    assert(observation.getWordsPerRow() == 2);
+    assert(observation.getPlaneCount() == GameObservation::Plane::firstGhost + 4);
+
+    for (int y = 0; y < 5; y++) {
+        for (int x = 0; x < 83; x++) {
+            Position pos(x, y);
+            Board::Tile::Type t = board.tileAt(pos);
+            assert(observation.test(GameObservation::Plane::walls, pos) == (t == Board::Tile::Type::wall));
+            assert(observation.test(GameObservation::Plane::coins, pos) == (t == Board::Tile::Type::coin));
+            assert(observation.test(GameObservation::Plane::frighten, pos) == (t == Board::Tile::Type::frighten));
+            assert(observation.test(GameObservation::Plane::bonus, pos) == (t == Board::Tile::Type::bonus));
+        }
+    }
+    assert(observation.test(GameObservation::Plane::player, Position(2, 2)));
+    assert(!observation.test(GameObservation::Plane::player, Position(1, 1)));
+}
+
+void autopilotTests() {
+    // Corridor with enemy spawn left of player and coin right of player
+    Matrix<Board::Tile::Type> tiles = corridorBoard(9, 5, 2);
+    tiles.at(0, 2) = Board::Tile::Type::wall;
+    tiles.at(8, 2) = Board::Tile::Type::wall;
+    tiles.at(7, 2) = Board::Tile::Type::coin;
+    Board board(tiles, Position(1, 2), Position(6, 2));
+
+    Game game(GameSettings(350, 400, 7000, 20000, 15000, 8000, 20000, 5000), 1.5, 3, 1, true);
+    game.loadBoard(board);
+    game.restart();
+
+    Autopilot autopilot;
+    std::optional<Rotation> rotation = autopilot.getPlayerRotation(game);
+    assert(rotation && *rotation == Rotation(Rotation::Direction::right));
+
+    // Time moves only when advanced
+    game.update(rotation);
+    game.advanceTime(349);
+    game.update(autopilot.getPlayerRotation(game));
+    assert(game.getCoinsRemaining() == 1);
+    game.advanceTime(1);
+    game.update(autopilot.getPlayerRotation(game));
+    assert(game.getCoinsRemaining() == 0);
+    assert(game.getScore() == 10);
+    assert(autopilot.getDecisions() >= 1);
+}
+
+void ghostPlannerTests() {
+    // Crossroad in the middle, player walled in single tile in corner
+    Matrix<Board::Tile::Type> tiles(7, 7);
+    for (size_t y = 0; y < tiles.getSizeY(); y++) {
+        for (size_t x = 0; x < tiles.getSizeX(); x++) {
+            bool cross = (y == 3 && x >= 1 && x <= 5) || (x == 3 && y >= 1 && y <= 5);
+            tiles.at(x, y) = cross ? Board::Tile::Type::space : Board::Tile::Type::wall;
+        }
+    }
+    tiles.at(1, 1) = Board::Tile::Type::space;
+    Board board(tiles, Position(1, 1), Position(3, 5));
+
+    GhostPlanner planner(5, 400, 350, 2);
+    planner.prepare(&board);
+
+    // Ghost entering crossroad gets exit, player that can't move is simulated standing
+    std::vector<std::optional<GhostPlanner::GhostState>> ghosts = {
+        GhostPlanner::GhostState { Position(3, 2), Rotation(Rotation::Direction::down) }
+    };
+    std::vector<std::optional<Position>> targets = planner.plan(ghosts, Transform(Position(1, 1), Rotation(Rotation::Direction::left)));
+    assert(targets.size() == 1 && targets[0]);
+    assert(Position::distanceBetween(*targets[0], Position(3, 3)) == 1.0);
+    assert(planner.getLastIterations() > 0);
+
+    // Plan started in background is used only by ghost that reached planned state
+    planner.start(ghosts, Transform(Position(1, 1), Rotation(Rotation::Direction::left)));
+    std::vector<std::optional<GhostPlanner::GhostState>> other = {
+        GhostPlanner::GhostState { Position(3, 1), Rotation(Rotation::Direction::down) }
+    };
+    assert(!planner.collect(other)[0]);
+    assert(!planner.collect(ghosts)[0]); //< Plan is collected only once
+
+    // Budget is limited by changed ghost period
+    planner.configure(1000, 40, 35);
+    assert(planner.plan(ghosts, Transform(Position(1, 1), Rotation(Rotation::Direction::left)))[0]);
+    assert(planner.getLastPlanTime() < 500);
+}
+
+void flowFieldsTests() {
+    // Single row corridor with teleport at both edges
+    Matrix<Board::Tile::Type> tiles = corridorBoard(7, 3, 1);
+    Board board(tiles, Position(3, 1), Position(3, 1));
+
+    FlowFields fields;
+    fields.prepare(&board);
+
+    FlowFields::Field & field = fields.fieldTo(Position(1, 1));
+    assert(fields.distanceIn(field, Position(1, 1)) == 0);
+    assert(field.distances.size() == 1); //< Search stops at looked up tile
+    assert(fields.distanceIn(field, Position(3, 1)) == 2);
+    assert(fields.distanceIn(field, Position(5, 1)) == 2); //< Through teleport
+    assert(fields.distanceIn(field, Position(1, 0)) == FlowFields::unreachable);
+
+    // Target outside of board or in wall is moved to the nearest tile allowing movement
+    assert(fields.resolveTarget(Position(-5, 10)) == Position(0, 1));
+    assert(fields.resolveTarget(Position(3, 0)) == Position(3, 1));
+
+    // Field is shared for the same target and kept while target is requested
+    fields.fieldTo(Position(1, 0));
+    fields.fieldTo(Position(1, 2));
+    assert(fields.getFieldsInUse() == 1);
+    fields.clear();
+    fields.fieldTo(Position(1, 1));
+    fields.fieldTo(Position(3, 1));
+    assert(fields.getComputedFields() == 2);
+    fields.clear();
+    fields.fieldTo(Position(3, 1));
+    fields.clear();
+    fields.fieldTo(Position(1, 1));
+    assert(fields.getComputedFields() == 3);
+}
+
+void rosterTests() {
+    Matrix<Board::Tile::Type> tiles = corridorBoard(9, 5, 2);
+    tiles.at(0, 2) = Board::Tile::Type::wall;
+    tiles.at(8, 2) = Board::Tile::Type::wall;
+    Board board(tiles, Position(1, 2), Position(6, 2));
+
+    GameSettings settings(350, 400, 7000, 20000, 15000, 8000, 20000, 5000);
+    settings.ghostRoster.push_back(GameSettings::GhostGroup { "pinky", 3, 0, 0, 100 });
+    settings.ghostRoster.push_back(GameSettings::GhostGroup { "clyde", 2, -1, -1, 50 });
+
+    Game game(settings, 1.5, 3, 1, true);
+    game.loadBoard(board);
+    game.restart();
+    game.update(Rotation(Rotation::Direction::right));
+
+    GameObservation observation(&game);
+    assert(observation.getPlaneCount() == GameObservation::Plane::firstGhost + 5);
+
+    // Groups come out at their release times
+    game.advanceTime(50);
+    game.update({ });
+    observation.update();
+    assert(!observation.test(GameObservation::Plane::firstGhost, Position(1, 2)));
+    assert(observation.test(GameObservation::Plane::firstGhost + 4, Position(1, 2)));
+    game.advanceTime(50);
+    game.update({ });
+    observation.update();
+    assert(observation.test(GameObservation::Plane::firstGhost, Position(1, 2)));
+
+    // Roster with too many ghosts (also negative count, which wraps) is rejected
+    const char * path = "/tmp/dobesmic_roster_test.spac";
+    std::string values = "player_periodspeed> 350\nghost_periodspeed> 400\nscatter_duration> 7000\n"
+        "chase_duration> 20000\nfrighten_duration> 15000\nkill_duration> 8000\n"
+        "bonus_period> 20000\nghost_begin_period> 5000\n";
+    for (const char * roster : {
+        "ghost> blinky 100000000 0 0 0\n",
+        "ghost> blinky -1 0 0 0\n",
+        "ghost> blinky 8000 0 0 0\nghost> pinky 8000 0 0 0\n" }) {
+        {
+            std::ofstream out(path);
+            out << values << roster;
+        }
+        GameSettingsRecordsFileLoader loader(path);
+        bool thrown = false;
+        try {
+            loader.loadSettingsAndRecords();
+        }
+        catch (FileLoaderException & e) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    {
+        std::ofstream out(path);
+        out << values << "ghost> blinky 8192 0 0 0\n";
+    }
+    assert(GameSettingsRecordsFileLoader(path).loadSettingsAndRecords().first.ghostRoster[0].count == GAMEMAXGHOSTS);
+    std::remove(path);
+}
+
+void chunkedBoardTests() {
+    ChunkedMatrix<int> m(200, 70, 1);
+    assert(m.getAllocatedChunks() == 0);
+    m.set(130, 65, 5);
+    assert(m.at(130, 65) == 5);
+    assert(m.at(129, 65) == 1);
+    assert(m.getAllocatedChunks() == 1);
+
+    ChunkedMatrix<int> copied(m);
+    copied.set(130, 65, 1);
+    assert(m.at(130, 65) == 5);
+    copied.compact();
+    assert(copied.getAllocatedChunks() == 0);
+
+    int row[10];
+    m.readRow(65, 125, 10, row);
+    assert(row[4] == 1 && row[5] == 5 && row[6] == 1);
+
+    // Large board is stored in chunks, but behaves the same
+    Matrix<Board::Tile::Type> tiles = corridorBoard(1100, 1000, 500, Board::Tile::Type::coin);
+    Board board(tiles, Position(1, 500), Position(2, 500));
+    assert(board.isChunked());
+    assert(board.getNumberOfCoins() == 1100);
+    assert(board.tileAt(Position(700, 500)) == Board::Tile::Type::coin);
+    assert(board.tileAt(Position(700, 499)) == Board::Tile::Type::wall);
+    assert(board.neighbourPosition(Position(1, 500), Rotation(Rotation::Direction::left)) == Position(1099, 500));
+    assert(board.interactWithTileAt(Position(700, 500)));
+    assert(board.getNumberOfCoins() == 1099);
+
+    std::vector<Board::Tile::Type> buffer;
+    const Board::Tile::Type * tileRow = board.tileRow(500, 690, 20, buffer);
+    assert(tileRow[9] == Board::Tile::Type::coin && tileRow[10] == Board::Tile::Type::space);
+}
+
+void boardLoaderTests() {
+    const char * path = "/tmp/dobesmic_loader_test.mpac";
+
+    // Last line without newline
+    {
+        std::ofstream out(path);
+        out << "#####\n# P.#\n  E  \n#o..#\n#####";
+    }
+    {
+        BoardFileLoader loader(path);
+        Board board = loader.loadBoard();
+        assert(board.getSizeX() == 5 && board.getSizeY() == 5);
+        assert(board.getPlayerSpawn() == Position(2, 1));
+        assert(board.getEnemySpawn() == Position(2, 2));
+        assert(board.tileAt(Position(1, 3)) == Board::Tile::Type::frighten);
+        assert(board.getNumberOfCoins() == 3);
+    }
+
+    // Line of different length
+    {
+        std::ofstream out(path);
+        out << "#####\n# P.#\n  E \n#o..#\n#####\n";
+    }
+    {
+        BoardFileLoader loader(path);
+        bool thrown = false;
+        try {
+            loader.loadBoard();
+        }
+        catch (FileLoaderException & e) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::remove(path);
+}
+
+void mapAnalysisTests() {
+    // Corridor through teleports with a walled off coin
+    Matrix<Board::Tile::Type> tiles = corridorBoard(9, 5, 2, Board::Tile::Type::coin);
+    tiles.at(4, 2) = Board::Tile::Type::space;
+    tiles.at(4, 1) = Board::Tile::Type::space;
+    tiles.at(6, 3) = Board::Tile::Type::coin;
+    tiles.at(2, 4) = Board::Tile::Type::frighten;
+    tiles.at(2, 0) = Board::Tile::Type::frighten;
+    tiles.at(2, 1) = Board::Tile::Type::wall;
+    tiles.at(2, 3) = Board::Tile::Type::wall;
+    Board board(tiles, Position(4, 1), Position(4, 2));
+
+    MapAnalysis analysis(board);
+    assert(analysis.coins == 9);
+    assert(analysis.reachableCoins == 9);
+    assert(analysis.frightens == 2);
+    assert(analysis.reachableFrightens == 0);
+    assert(analysis.enemySpawnReachable);
+    assert(analysis.crossroads == 2);
+    assert(analysis.deadEnds == 2);
+    assert(analysis.isPlayable());
+
+    tiles.at(5, 2) = Board::Tile::Type::wall;
+    tiles.at(3, 2) = Board::Tile::Type::wall;
+    MapAnalysis walledOff(Board(tiles, Position(4, 1), Position(4, 2)));
+    assert(walledOff.reachableCoins == 0);
+    assert(!walledOff.isPlayable());
+}
+
+void mazeGeneratorTests() {
+    const char * path = "/tmp/dobesmic_generator_test.mpacb";
+
+    for (unsigned long seed = 0; seed < 8; seed++) {
+        MazeGenerator generator(44, 21, seed / 8.0, (seed % 2) ? MazeGenerator::Symmetry::mirror : MazeGenerator::Symmetry::none, seed);
+        Board board = generator.generate();
+        assert(board.getSizeX() == 43 && board.getSizeY() == 21);
+        assert(MapAnalysis(board).isPlayable());
+
+        // Binary file is loaded as the same board
+        {
+            BoardFileSaver saver(path, true);
+            saver.writeBoard(board);
+        }
+        BoardFileLoader loader(path);
+        Board loaded = loader.loadBoard();
+        assert(loaded.getPlayerSpawn() == board.getPlayerSpawn());
+        assert(loaded.getEnemySpawn() == board.getEnemySpawn());
+        assert(loaded.getNumberOfCoins() == board.getNumberOfCoins());
+        for (size_t y = 0; y < board.getSizeY(); y++) {
+            for (size_t x = 0; x < board.getSizeX(); x++) {
+                assert(loaded.tileAt(Position(x, y)) == board.tileAt(Position(x, y)));
+            }
+        }
+    }
+    std::remove(path);
+}
+
+void mapIndexTests() {
+    std::filesystem::path directory = "/tmp/dobesmic_index_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    {
+        std::ofstream valid(directory / "a.mpac");
+        valid << "#####\n# P.#\n  E  \n#o..#\n#####\n";
+        std::ofstream invalid(directory / "b.mpac");
+        invalid << "#####\n# P.#\n";
+        std::ofstream ignored(directory / "c.txt");
+    }
+
+    MapIndex index(directory.string());
+    assert(index.update({ ".mpac" }) == 2);
+    assert(index.getEntries().size() == 2);
+    assert(index.getEntries()[0].name == "a.mpac" && index.getEntries()[0].valid);
+    assert(index.getEntries()[0].sizeX == 5 && index.getEntries()[0].coins == 3);
+    assert(!index.getEntries()[1].valid);
+
+    // Unchanged maps are taken from index file
+    MapIndex reopened(directory.string());
+    assert(reopened.update({ ".mpac" }) == 0);
+    assert(reopened.getEntries()[0].coins == index.getEntries()[0].coins);
+
+    {
+        std::ofstream changed(directory / "b.mpac", std::ios::app);
+        changed << "  E  \n#o..#\n#####\n";
+    }
+    assert(reopened.update({ ".mpac" }) == 1);
+    assert(reopened.getEntries()[1].valid);
+
+    std::filesystem::remove_all(directory);
+}
+
+void gameRecordsTests() {
+    GameRecords records;
+    assert(records.getRank("a.mpac", 0, 10).rank == 1);
+    assert(records.getTopScores("a.mpac", 0, 3).empty());
+
+    assert(records.addScore("a.mpac", 0, 30));
+    assert(!records.addScore("a.mpac", 0, 10, 2));
+    assert(records.addScore("a.mpac", 0, 50));
+    assert(records.addScore("a.mpac", 1, 5));
+    assert(!records.addScore("a.mpac", 0, 30));
+
+    assert(records.getBestScore("a.mpac", 0) == 50);
+    assert(records.getRuns("a.mpac", 0) == 5);
+    assert((records.getTopScores("a.mpac", 0, 3) == std::vector<unsigned long> { 50, 30, 30 }));
+
+    GameRecords::Rank rank = records.getRank("a.mpac", 0, 30);
+    assert(rank.rank == 2 && rank.runs == 5 && rank.percentile == 80.0);
+    assert(records.getRank("a.mpac", 0, 60).rank == 1);
+    assert(records.getRank("a.mpac", 0, 0).rank == 6);
+
+    // Distinct scores with their runs, best score first
+    std::vector<GameRecords::Record> all = records.getRecords();
+    assert(all.size() == 4 && records.getDistinctScores() == 4);
+    assert(all[0].score == 50 && all[1].score == 30 && all[1].runs == 2 && all[3].difficulty == 1);
+
+    // Scores added in ascending order, rank is kept for each inserted score
+    for (unsigned long score = 1; score <= 1000; score++) {
+        records.addScore("b.mpac", 0, score * 10);
+        assert(records.getRank("b.mpac", 0, score * 10).rank == 1);
+    }
+    assert(records.getRank("b.mpac", 0, 5005).rank == 501);
+    assert((records.getTopScores("b.mpac", 0, 2) == std::vector<unsigned long> { 10000, 9990 }));
+}
+
+void recordsLogTests() {
+    std::string settingsPath = "/tmp/dobesmic_records_test.spac";
+    GameRecordsLog log(settingsPath);
+    std::filesystem::remove(log.getLogPath());
+
+    GameRecords records;
+    log.load(records);
+    assert(records.getRecords().empty());
+
+    log.append("a.mpac", 1, 100);
+    log.append("a.mpac", 1, 300);
+    log.append("b.mpac", 2, 50);
+
+    // Interrupted line is ignored and removed by next append
+    {
+        std::ofstream torn(log.getLogPath(), std::ios::app);
+        torn << "b.mpac\t2\t9";
+    }
+    GameRecordsLog reopened(settingsPath);
+    reopened.load(records);
+    assert(records.getBestRecords().size() == 2);
+    assert(records.getBestScore("a.mpac", 1) == 300);
+    assert(records.getBestScore("b.mpac", 2) == 50 && records.getRuns("b.mpac", 2) == 1);
+
+    reopened.append("c.mpac", 0, 10);
+    GameRecords appended;
+    GameRecordsLog(settingsPath).load(appended);
+    assert(appended.getBestScore("c.mpac", 0) == 10);
+    assert(appended.getRuns("b.mpac", 2) == 1 && appended.getBestScore("b.mpac", 2) == 50);
+
+    // Long log is compacted to one line per distinct score
+    for (unsigned long run = 0; run < RECORDSLOGCOMPACTMINLINES; run++) {
+        reopened.append("a.mpac", 1, 300 + RECORDSLOGCOMPACTMINLINES);
+    }
+    std::ifstream compacted(log.getLogPath());
+    size_t lines = std::count(std::istreambuf_iterator<char>(compacted), std::istreambuf_iterator<char>(), '\n');
+    assert(lines < RECORDSLOGCOMPACTMINLINES);
+
+    GameRecords final;
+    GameRecordsLog(settingsPath).load(final);
+    assert(final.getBestRecords().size() == 3);
+    assert(final.getBestScore("a.mpac", 1) == 300 + RECORDSLOGCOMPACTMINLINES);
+    assert(final.getRuns("a.mpac", 1) == 2 + RECORDSLOGCOMPACTMINLINES);
+
+    std::filesystem::remove(log.getLogPath());
+    std::filesystem::remove(log.getLogPath() + RECORDSLOGLOCKEXTENSION);
+}
+
+void recordsLogConcurrencyTests() {
+    std::string settingsPath = "/tmp/dobesmic_records_concurrency_test.spac";
+    std::filesystem::remove(settingsPath + RECORDSLOGEXTENSION);
+
+    // Writers append and compact the same log, no run may be lost
+    std::vector<std::thread> writers;
+    for (unsigned int w = 0; w < 4; w++) {
+        writers.emplace_back([ settingsPath, w ]() {
+            GameRecordsLog writerLog(settingsPath);
+            for (unsigned long run = 0; run < 100; run++) {
+                writerLog.append("a.mpac", w % 2, run % 10);
+            }
+            writerLog.appendRuns({ { "b.mpac", 0, 5, 10 }, { "b.mpac", 0, 7, 1 } });
+            writerLog.compact();
+        });
+    }
+    for (auto & w : writers) {
+        w.join();
+    }
+
+    GameRecords records;
+    GameRecordsLog log(settingsPath);
+    log.load(records);
+    assert(records.getRuns("a.mpac", 0) == 200 && records.getRuns("a.mpac", 1) == 200);
+    assert(records.getRuns("b.mpac", 0) == 44 && records.getBestScore("b.mpac", 0) == 7);
+
+    std::filesystem::remove(log.getLogPath());
+    std::filesystem::remove(log.getLogPath() + RECORDSLOGLOCKEXTENSION);
+}
+
+void settingsReloadTests() {
+    // Changed period is counted from the last performance of trigger
+    Timer timer(true);
+    timer.togglePause();
+    int performed = 0;
+    Timer::TriggerId trigger = timer.addTrigger(100, [ &performed ]() { performed++; }, true);
+    timer.advance(100);
+    timer.update();
+    assert(performed == 1);
+    assert(timer.setPeriod(trigger, 300));
+    timer.advance(200);
+    timer.update();
+    assert(performed == 1);
+    timer.advance(100);
+    timer.update();
+    assert(performed == 2);
+    assert(!timer.setPeriod(trigger + 1, 10));
+
+    // Settings file is loaded again when it is replaced
+    std::filesystem::path directory = "/tmp/dobesmic_watch_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    std::string settings = "player_periodspeed> 350\nghost_periodspeed> 400\nscatter_duration> 7000\n"
+        "chase_duration> 20000\nfrighten_duration> 15000\nkill_duration> 8000\n"
+        "bonus_period> 20000\nghost_begin_period> 5000\n";
+    {
+        std::ofstream file(directory / "a.spac");
+        file << settings;
+    }
+
+    SettingsWatcher watcher((directory / "a.spac").string());
+    if (watcher.isWatching()) {
+        assert(!watcher.takeSettings());
+        {
+            std::ofstream file(directory / "a.spac.tmp");
+            file << "player_periodspeed> 100" << settings.substr(settings.find('\n'));
+        }
+        std::filesystem::rename(directory / "a.spac.tmp", directory / "a.spac");
+
+        std::optional<GameSettings> changed;
+        for (int wait = 0; wait < 200 && !changed; wait++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            changed = watcher.takeSettings();
+        }
+        assert(changed && changed->playerSpeed == 100);
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+void histogramTests() {
+    Histogram histogram;
+    assert(histogram.getPercentile(50) == 0 && histogram.getMax() == 0);
+
+    for (uint64_t value = 1; value <= 1000; value++) {
+        histogram.record(value);
+    }
+    assert(histogram.getCount() == 1000 && histogram.getTotal() == 500500 && histogram.getMax() == 1000);
+
+    // Percentiles are at most one bucket (1/8 of power of two) above exact value
+    uint64_t p50 = histogram.getPercentile(50);
+    uint64_t p99 = histogram.getPercentile(99);
+    assert(p50 >= 500 && p50 < 500 + 64);
+    assert(p99 >= 990 && p99 <= 1000);
+    assert(histogram.getPercentile(100) == 1000);
+
+    Histogram other;
+    other.record(7);
+    other.record(1ULL << 40);
+    histogram.merge(other);
+    assert(histogram.getCount() == 1002 && histogram.getMax() == (1ULL << 40));
+    assert(histogram.getPercentile(0) == 1);
+}
+
+void tracerTests() {
+    std::string path = "/tmp/dobesmic_trace_test.json";
+    Tracer::instant("test", "not recorded");
+    assert(Tracer::enable(path));
+
+    // Each thread writes into its own ring
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([ ]() {
+            for (int e = 0; e < 1000; e++) {
+                Tracer::Scope scope("test", "scope");
+            }
+        });
+    }
+    for (auto & t : threads) {
+        t.join();
+    }
+
+    Timer timer(true);
+    timer.togglePause();
+    timer.addTrigger(10, [ ]() { }, false, "traced trigger");
+    timer.advance(15);
+    timer.update();
+
+    assert(Tracer::finish());
+    assert(Tracer::finish()); //< Finishing disabled tracer does nothing
+
+    std::ifstream file(path);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    size_t scopes = 0;
+    for (size_t at = content.find("\"scope\""); at != std::string::npos; at = content.find("\"scope\"", at + 1)) {
+        scopes++;
+    }
+    assert(scopes == 4000);
+    assert(content.find("not recorded") == std::string::npos);
+    assert(content.find("\"traced trigger\"") != std::string::npos);
+    assert(content.find("\"late_us\":5000") != std::string::npos);
+    assert(content.substr(content.size() - 3) == "]}\n");
+
+    std::filesystem::remove(path);
+}
+
+void timerCatchUpTests() {
+    Timer timer(true);
+    timer.togglePause();
+    int all = 0, once = 0, skip = 0;
+    timer.addTrigger(100, [ &all ]() { all++; }, true, "all", Timer::CatchUp::all);
+    timer.addTrigger(100, [ &once ]() { once++; }, true, "once", Timer::CatchUp::once);
+    timer.addTrigger(100, [ &skip ]() { skip++; }, true, "skip", Timer::CatchUp::skip);
+
+    // Late updates don't move schedule
+    for (int i = 0; i < 10; i++) {
+        timer.advance(130);
+        timer.update();
+        timer.advance(70);
+        timer.update();
+    }
+    assert(all == 20 && once == 20 && skip == 20);
+
+    // Stall of three and half periods
+    timer.advance(350);
+    timer.update();
+    assert(all == 23 && once == 21 && skip == 20);
+    timer.advance(50);
+    timer.update();
+    assert(all == 24 && once == 22 && skip == 21);
+
+    // Single time updates perform missed performances one planned time after another
+    timer.advance(300);
+    assert(timer.update(true) == 3);
+    assert(timer.update(true) == 1);
+    assert(timer.update(true) == 1);
+    assert(timer.update(true) == 0);
+
+    for (auto & lateness : timer.getLateness()) {
+        if (std::string(lateness.name) == "skip") {
+            assert(lateness.skipped == 6 && lateness.performed.getCount() == 21);
+        }
+        if (std::string(lateness.name) == "all") {
+            assert(lateness.skipped == 0 && lateness.performed.getCount() == 27);
+            assert(lateness.performed.getMax() == 250000000);
+        }
+    }
+
+    // Action slower than its period, catching up to time taken once ends
+    Timer slowTimer(true);
+    slowTimer.togglePause();
+    int slow = 0;
+    slowTimer.addTrigger(10, [ &slow, &slowTimer ]() { slow++; slowTimer.advance(15); }, true, "slow", Timer::CatchUp::all);
+    slowTimer.advance(10);
+    Timer::timepoint until = slowTimer.now();
+    size_t updates = 0;
+    while (slowTimer.update(true, until) != 0) {
+        updates++;
+        assert(updates < 10);
+    }
+    assert(slow == 1 && updates == 1);
+    assert(slowTimer.timeToNextTrigger() == 0);
+
+    // Missed performances are skipped, schedule is kept
+    assert(slowTimer.skipMissed() == 1);
+    assert(slowTimer.timeToNextTrigger() == 5);
+    assert(slowTimer.update() == 0 && slow == 1);
+}
+
+void benchmarkTests() {
+    // Only benchmarks matching filter are run, each with given number of samples
+    std::ostringstream out, log;
+    BenchmarkRunner runner("examples", "Matrix::at", 3);
+    assert(runner.run(out, log) == 0);
+    std::string json = out.str();
+    assert(json.find("\"name\":\"Matrix::at\"") != std::string::npos);
+    assert(json.find("Timer") == std::string::npos);
+    std::string samples = json.substr(json.find("\"samples_ns\":["));
+    assert(std::count(samples.begin(), samples.end(), ',') == 2);
+
+    BenchmarkRunner missingExamples("/nonexistent", "loadBoard/small", 1);
+    assert(missingExamples.run(out, log) == 1);
+}
+
+void benchmarkComparisonTests() {
+    std::istringstream json("{\"benchmarks\":[\n{\"name\":\"a\",\"median_ns\":2,\"samples_ns\":[1,2.5,3e2]},\n"
+        "{\"name\":\"b\",\"samples_ns\":[]}\n]}");
+    BenchmarkComparison::Samples samples = BenchmarkComparison::parseResults(json);
+    assert(samples.size() == 2);
+    assert((samples["a"] == std::vector<double> { 1, 2.5, 300 }));
+    assert(samples["b"].empty());
+
+    // Clear slowdown is significant, the same samples or a speedup are not
+    std::vector<double> baseline, slower, faster;
+    for (int i = 0; i < 30; i++) {
+        baseline.push_back(100 + i % 7);
+        slower.push_back(130 + i % 7);
+        faster.push_back(70 + i % 7);
+    }
+    assert(BenchmarkComparison::mannWhitneyPValue(slower, baseline) < 0.001);
+    assert(BenchmarkComparison::mannWhitneyPValue(baseline, baseline) > 0.4);
+    assert(BenchmarkComparison::mannWhitneyPValue(faster, baseline) > 0.999);
+
+    assert(BenchmarkComparison::compare("a", slower, baseline, 20).regression);
+    assert(!BenchmarkComparison::compare("a", slower, baseline, 40).regression);
+    assert(!BenchmarkComparison::compare("a", faster, baseline, 20).regression);
+}
+
+void terminalScreenTests() {
+    TerminalScreen screen(4, 10);
+    std::string output = "\x1b[?1049h\x1b[H\x1b[2Jab\x1b[2;3H\x1b[33m<\x1b[39m-\x1b[2b\x1b[4;1Hpaused";
+    screen.feed(output.data(), output.size());
+    assert(screen.getLine(0) == "ab        ");
+    assert(screen.getLine(1) == "  <---    ");
+    assert(screen.getForeground(1, 2) == 3);
+    assert(screen.getForeground(1, 3) == -1);
+    assert(screen.contains("paused"));
+
+    std::vector<TerminalScreen::Write> writes = screen.takeWrites();
+    assert(writes.size() == 12);
+    assert(writes[2].line == 1 && writes[2].column == 2 && writes[2].character == '<' && writes[2].foreground == 3);
+    assert(screen.takeWrites().empty());
+
+    // Sequences split between outputs, erasing rest of line
+    std::string first = "\x1b[2;4";
+    std::string second = "H\x1b[K\x1b[38;5;3mv";
+    screen.feed(first.data(), first.size());
+    screen.feed(second.data(), second.size());
+    assert(screen.getLine(1) == "  <v      ");
+    assert(screen.getForeground(1, 3) == 3);
+    writes = screen.takeWrites();
+    assert(writes.size() == 1 && writes[0].column == 3);
+}
+
+void ansiRendererTests() {
+    FILE * output = std::fopen("/dev/null", "w");
+    FILE * input = std::fopen("/dev/null", "r");
+    SCREEN * screen = newterm("xterm-256color", output, input);
+    assert(screen != nullptr);
+    resizeterm(5, 20);
+    start_color();
+    use_default_colors();
+    init_pair(1, COLOR_YELLOW, -1);
+
+    int ends[2];
+    assert(pipe(ends) == 0);
+    fcntl(ends[0], F_SETFL, O_NONBLOCK);
+    auto take = [ &ends ]() {
+        char buffer[65536];
+        ssize_t size = read(ends[0], buffer, sizeof(buffer));
+        return std::string(buffer, std::max<ssize_t>(0, size));
+    };
+
+    // First update clears terminal and writes whole screen
+    AnsiRenderer renderer(ends[1]);
+    WINDOW * window = newwin(5, 20, 0, 0);
+    box(window, 0, 0);
+    mvwaddstr(window, 1, 2, "abc");
+    wattron(window, COLOR_PAIR(1));
+    mvwaddch(window, 1, 6, '<');
+    wattroff(window, COLOR_PAIR(1));
+    wnoutrefresh(window);
+    renderer.updateScreen();
+
+    std::string written = take();
+    TerminalScreen terminal(5, 20);
+    terminal.feed(written.data(), written.size());
+    assert(terminal.getLine(0) == "lqqqqqqqqqqqqqqqqqqk");
+    assert(terminal.getLine(1) == "x abc <            x");
+    assert(terminal.getForeground(1, 6) == COLOR_YELLOW);
+    assert(terminal.getForeground(1, 2) == -1);
+
+    // Undamaged screen writes nothing, changes in damaged regions are written with
+    // shortest movement and only differing rendition
+    wnoutrefresh(window);
+    renderer.damage(0, 0, 5, 20);
+    renderer.updateScreen();
+    assert(take().empty());
+
+    mvwaddch(window, 1, 2, 'y');
+    mvwaddch(window, 1, 4, 'z');
+    wnoutrefresh(window);
+    renderer.updateScreen();
+    assert(take().empty());
+    renderer.damage(1, 2, 1, 3);
+    renderer.updateScreen();
+    assert(take() == "\x1b[2;3Hybz");
+
+    mvwaddch(window, 1, 2, 'q');
+    wattron(window, COLOR_PAIR(1));
+    mvwaddch(window, 1, 6, '>');
+    mvwaddch(window, 3, 1, '>');
+    wattroff(window, COLOR_PAIR(1));
+    wnoutrefresh(window);
+    renderer.damage(1, 2, 1, 1);
+    renderer.damage(1, 6, 3, 1);
+    renderer.damage(3, 1, 1, 1);
+    renderer.updateScreen();
+    assert(take() == "\x1b[2;3Hqbz \x1b[33m>\x1b[4;2H>\x1b[0m");
+
+    delwin(window);
+    endwin();
+    delscreen(screen);
+    close(ends[0]);
+    close(ends[1]);
+    std::fclose(output);
+    std::fclose(input);
+}
+
+/**
+ * @brief View damaging one cell on each line
+ *
+ */
+struct DiagonalView : public View {
+    void draw(WINDOW *) override {
+        for (unsigned int i = 0; i < 40; i++) {
+            damage(i, i);
+        }
+    }
+};
+
+void viewDamageTests() {
+    DiagonalView view;
+    assert(!view.isDamaged());
+
+    // Regions over limit are merged into one covering all of them
+    view.draw(nullptr);
+    assert(view.isDamaged());
+    std::vector<View::Region> regions = view.takeDamage();
+    assert(!regions.empty() && regions.size() <= VIEWMAXDAMAGEDREGIONS);
+    for (unsigned int i = 0; i < 40; i++) {
+        bool covered = false;
+        for (auto & region : regions) {
+            covered = covered || (i >= region.y && i < region.y + region.sizeY
+                && i >= region.x && i < region.x + region.sizeX);
+        }
+        assert(covered);
+    }
+    assert(!view.isDamaged());
+    assert(view.takeDamage().empty());
+}
+
+/**
+ * @brief View counting how many times it was drawn whole
+ *
+ */
+struct CountingView : public View {
+    unsigned int redraws = 0; //< Number of whole redraws
+
+    CountingView(unsigned int width) {
+        minSizeX = width;
+        minSizeY = 5;
+    }
+
+    void draw(WINDOW * intoWindow) override {
+        getWindowSize(intoWindow);
+        if (needsRefresh || sizeChanged) {
+            werase(intoWindow);
+            damageWhole();
+            redraws++;
+        }
+        wnoutrefresh(intoWindow);
+        needsRefresh = false;
+    }
+};
+
+void layoutViewTests() {
+    FILE * output = std::fopen("/dev/null", "w");
+    FILE * input = std::fopen("/dev/null", "r");
+    SCREEN * screen = newterm("xterm-256color", output, input);
+    assert(screen != nullptr);
+    resizeterm(20, 100);
+
+    {
+        LayoutView layout;
+        CountingView & secondary = layout.emplaceSecondaryView<CountingView>(30);
+        layout.emplacePrimaryView<CountingView>(10);
+        layout.draw();
+        WINDOW * primaryWindow = layout.getPrimaryWindow();
+        assert(primaryWindow != nullptr && getmaxx(primaryWindow) == 100 - 30 - 1);
+        assert(getmaxx(layout.getSecondaryWindow()) == 30);
+        assert(secondary.redraws == 1);
+
+        // Replaced view is drawn into kept window, other view is left untouched
+        CountingView & primary = layout.emplacePrimaryView<CountingView>(20);
+        assert(layout.getPrimaryView() == &primary);
+        layout.draw();
+        assert(layout.getPrimaryWindow() == primaryWindow);
+        assert(primary.redraws == 1);
+        assert(secondary.redraws == 1);
+
+        // View of different width moves windows and everything is drawn again
+        layout.setSecondaryView(std::make_unique<CountingView>(40));
+        layout.draw();
+        assert(getmaxx(layout.getPrimaryWindow()) == 100 - 40 - 1);
+        assert(getmaxx(layout.getSecondaryWindow()) == 40);
+        assert(primary.redraws == 2);
+
+        // Nothing replaced, nothing drawn
+        layout.draw();
+        assert(primary.redraws == 2);
+    }
+
+    endwin();
+    delscreen(screen);
+    std::fclose(output);
+    std::fclose(input);
+}
+
 int main(void) {
     matrixTests();
     transformTests();
+    observationTests();
+    autopilotTests();
+    ghostPlannerTests();
+    flowFieldsTests();
+    rosterTests();
+    chunkedBoardTests();
+    boardLoaderTests();
+    mapAnalysisTests();
+    mazeGeneratorTests();
+    mapIndexTests();
+    gameRecordsTests();
+    recordsLogTests();
+    recordsLogConcurrencyTests();
+    settingsReloadTests();
+    histogramTests();
+    tracerTests();
+    timerCatchUpTests();
+    benchmarkTests();
+    benchmarkComparisonTests();
+    terminalScreenTests();
+    ansiRendererTests();
+    viewDamageTests();
+    layoutViewTests();
 }
\ No newline at end of file
@@ -0,0 +1,33 @@
+/****************************************************************
+ * @file analyzer.cpp
+ * @author Michal Dobes
+ * @brief dobesmic's PacMan map analyzer
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "MapAnalyzer.h"
+
+int main(int argc, char * argv[]) {
+    // dobesmic-analyzer <directory> [threads]
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <directory> [threads]" << std::endl;
+        return 1;
+    }
+
+    try {
+        size_t threads = (argc >= 3) ? std::stoul(argv[2]) : 0;
+
+        MapAnalyzer analyzer(argv[1], threads);
+        return analyzer.run(std::cout);
+    }
+    catch (std::logic_error & e) { //< Number couldn't be converted
+        std::cerr << "Threads need to be a number" << std::endl;
+        return 1;
+    }
+}
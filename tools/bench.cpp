@@ -0,0 +1,30 @@
+/****************************************************************
+ * @file bench.cpp
+ * @author Michal Dobes
+ * @brief dobesmic's PacMan microbenchmarks
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "BenchmarkRunner.h"
+
+int main(int argc, char * argv[]) {
+    // dobesmic-bench [examples directory] [filter] [samples]
+    try {
+        std::string examples = (argc >= 2) ? argv[1] : "examples";
+        std::string filter = (argc >= 3) ? argv[2] : "";
+        unsigned int samples = (argc >= 4) ? std::stoul(argv[3]) : BENCHMARKSAMPLES;
+
+        BenchmarkRunner runner(examples, filter, samples);
+        return runner.run(std::cout, std::cerr);
+    }
+    catch (std::logic_error & e) { //< Number couldn't be converted
+        std::cerr << "Usage: " << argv[0] << " [examples directory] [filter] [samples]" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,36 @@
+/****************************************************************
+ * @file compare.cpp
+ * @author Michal Dobes
+ * @brief dobesmic's PacMan benchmark regression gate
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "BenchmarkComparison.h"
+
+int main(int argc, char * argv[]) {
+    // dobesmic-compare <baseline file> [runs] [threshold %] [examples directory] [filter]
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <baseline file> [runs] [threshold %] [examples directory] [filter]" << std::endl;
+        return 2;
+    }
+
+    try {
+        unsigned int runs = (argc >= 3) ? std::stoul(argv[2]) : COMPARISONRUNS;
+        double threshold = (argc >= 4) ? std::stod(argv[3]) : COMPARISONTHRESHOLD;
+        std::string examples = (argc >= 5) ? argv[4] : "examples";
+        std::string filter = (argc >= 6) ? argv[5] : "";
+
+        BenchmarkComparison comparison(argv[1], runs, threshold, examples, filter);
+        return comparison.run(std::cout, std::cerr);
+    }
+    catch (std::logic_error & e) { //< Number couldn't be converted
+        std::cerr << "Runs and threshold need to be numbers" << std::endl;
+        return 2;
+    }
+}
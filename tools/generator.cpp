@@ -0,0 +1,50 @@
+/****************************************************************
+ * @file generator.cpp
+ * @author Michal Dobes
+ * @brief dobesmic's PacMan map generator
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "MapGenerator.h"
+
+int main(int argc, char * argv[]) {
+    // dobesmic-generator <directory> <maps> <size x> <size y> [density] [symmetry] [seed] [format]
+    if (argc < 5) {
+        std::cerr << "Usage: " << argv[0]
+            << " <directory> <maps> <size x> <size y> [density] [none|mirror] [seed] [mpac|mpacb]" << std::endl;
+        return 1;
+    }
+
+    try {
+        unsigned long maps = std::stoul(argv[2]);
+        size_t sizeX = std::stoul(argv[3]);
+        size_t sizeY = std::stoul(argv[4]);
+        double density = (argc >= 6) ? std::stod(argv[5]) : 0.7;
+        std::string symmetryName = (argc >= 7) ? argv[6] : "mirror";
+        unsigned long seed = (argc >= 8) ? std::stoul(argv[7]) : 1;
+        std::string format = (argc >= 9) ? argv[8] : "mpac";
+
+        std::optional<MazeGenerator::Symmetry> symmetry = MazeGenerator::symmetryFromName(symmetryName);
+        if (!symmetry) {
+            std::cerr << "Unknown symmetry " << symmetryName << std::endl;
+            return 1;
+        }
+        if (format != "mpac" && format != "mpacb") {
+            std::cerr << "Unknown format " << format << std::endl;
+            return 1;
+        }
+
+        MapGenerator generator(argv[1], maps, sizeX, sizeY, density, symmetry.value(), seed, format == "mpacb");
+        return generator.run(std::cout);
+    }
+    catch (std::logic_error & e) { //< Number couldn't be converted
+        std::cerr << "Amount of maps, sizes, density and seed need to be numbers" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,45 @@
+/****************************************************************
+ * @file latency.cpp
+ * @author Michal Dobes
+ * @brief dobesmic's PacMan end to end input latency benchmark
+ * @date 2022-05-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ *****************************************************************/
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "LatencyRunner.h"
+
+int main(int argc, char * argv[]) {
+    // dobesmic-latency [game] [examples directory] [samples] [map sizes as XxY, 0x0 for default map...]
+    try {
+        std::string program = (argc >= 2) ? argv[1] : "./dobesmic";
+        std::string examples = (argc >= 3) ? argv[2] : "examples";
+        unsigned int samples = (argc >= 4) ? std::stoul(argv[3]) : LATENCYSAMPLES;
+
+        std::vector<std::pair<size_t, size_t>> sizes;
+        for (int i = 4; i < argc; i++) {
+            std::string size = argv[i];
+            size_t separator = size.find('x');
+            if (separator == std::string::npos) {
+                throw std::invalid_argument("size");
+            }
+            sizes.emplace_back(std::stoul(size.substr(0, separator)), std::stoul(size.substr(separator + 1)));
+        }
+        if (sizes.empty()) {
+            sizes = { { 0, 0 }, { 41, 21 }, { 121, 45 }, { 401, 201 } };
+        }
+
+        LatencyRunner runner(program, examples, sizes, samples);
+        return runner.run(std::cout);
+    }
+    catch (std::logic_error & e) { //< Number couldn't be converted
+        std::cerr << "Usage: " << argv[0] << " [game] [examples directory] [samples] [map sizes as XxY...]" << std::endl;
+        return 1;
+    }
+}